@@ -39,6 +39,9 @@ public class GravPlugin : ModuleRules
         PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"Chaos",
+				"PhysicsCore",
+				"NetCore"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
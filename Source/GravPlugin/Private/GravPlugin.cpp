@@ -3,16 +3,32 @@
 #include "GravPlugin.h"
 #include "Misc/MessageDialog.h"
 #include "Modules/ModuleManager.h"
-#include "Interfaces/IPluginManager.h"
-#include "Misc/Paths.h"
-#include "HAL/PlatformProcess.h"
-#include "GravPluginLibrary/ExampleLibrary.h"
+#include "GravityStats.h"
 
 #define LOCTEXT_NAMESPACE "FGravPluginModule"
 
+DEFINE_LOG_CATEGORY(LogGravity);
+UE_TRACE_CHANNEL_DEFINE(GravityChannel);
+
+DEFINE_STAT(STAT_GravityGather);
+DEFINE_STAT(STAT_GravityPriorityResolution);
+DEFINE_STAT(STAT_GravityNBodyBuild);
+DEFINE_STAT(STAT_GravityZoneEvaluation);
+DEFINE_STAT(STAT_GravityApplyGravity);
+DEFINE_STAT(STAT_GravityApplyDamping);
+DEFINE_STAT(STAT_GravityTrajectories);
+DEFINE_STAT(STAT_GravityZoneOnboarding);
+DEFINE_STAT(STAT_GravityActorsProcessed);
+DEFINE_STAT(STAT_GravityZoneEvaluations);
+DEFINE_STAT(STAT_GravityBlueprintEvaluations);
+DEFINE_STAT(STAT_GravityBodiesTouched);
+DEFINE_STAT(STAT_GravityActorsFull);
+DEFINE_STAT(STAT_GravityActorsReduced);
+DEFINE_STAT(STAT_GravityActorsAsleep);
+DEFINE_STAT(STAT_GravityActorsGrouped);
+
 void FGravPluginModule::StartupModule()
 {
-	FString BaseDir = IPluginManager::Get().FindPlugin("GravPlugin")->GetBaseDir();
 }
 
 void FGravPluginModule::ShutdownModule()
@@ -0,0 +1,149 @@
+// --- GravityBarnesHut.cpp ---
+#include "GravityBarnesHut.h"
+
+void FGravityBarnesHutTree::Reset()
+{
+	Nodes.Reset();
+	Bodies.Reset();
+}
+
+void FGravityBarnesHutTree::Build(TConstArrayView<FVector> Positions, TConstArrayView<double> Masses, TConstArrayView<int32> Keys)
+{
+	Reset();
+	if (Positions.Num() == 0) return;
+
+	FBox Bounds(ForceInit);
+	Bodies.Reserve(Positions.Num());
+	for (int32 Index = 0; Index < Positions.Num(); ++Index)
+	{
+		Bodies.Add({ Positions[Index], Masses[Index], Keys[Index] });
+		Bounds += Positions[Index];
+	}
+
+	FNode& Root = Nodes.AddDefaulted_GetRef();
+	Root.Center = Bounds.GetCenter();
+	Root.HalfSize = FMath::Max(Bounds.GetExtent().GetMax(), UE_DOUBLE_KINDA_SMALL_NUMBER);
+	Root.NumBodies = Bodies.Num();
+	Scratch.SetNumUninitialized(Bodies.Num(), EAllowShrinking::No);
+	BuildNode(0, 0);
+}
+
+void FGravityBarnesHutTree::BuildNode(int32 NodeIndex, int32 Depth)
+{
+	const int32 FirstBody = Nodes[NodeIndex].FirstBody;
+	const int32 NumBodies = Nodes[NodeIndex].NumBodies;
+	const FVector Center = Nodes[NodeIndex].Center;
+
+	double Mass = 0.0;
+	FVector WeightedPosition = FVector::ZeroVector;
+	for (int32 Index = FirstBody; Index < FirstBody + NumBodies; ++Index)
+	{
+		Mass += Bodies[Index].Mass;
+		WeightedPosition += Bodies[Index].Position * Bodies[Index].Mass;
+	}
+	Nodes[NodeIndex].Mass = Mass;
+	Nodes[NodeIndex].CenterOfMass = Mass > 0.0 ? WeightedPosition / Mass : Center;
+
+	if (NumBodies <= MaxLeafBodies || Depth >= MaxDepth) return;
+
+	//Counting sort of the node's range into octants, empty octants get no child
+	auto Octant = [&Center](const FVector& Position)
+	{
+		return (Position.X >= Center.X ? 1 : 0) | (Position.Y >= Center.Y ? 2 : 0) | (Position.Z >= Center.Z ? 4 : 0);
+	};
+	int32 Counts[8] = {};
+	for (int32 Index = FirstBody; Index < FirstBody + NumBodies; ++Index)
+	{
+		Counts[Octant(Bodies[Index].Position)]++;
+	}
+	int32 Offsets[8];
+	int32 Running = FirstBody;
+	for (int32 Child = 0; Child < 8; ++Child)
+	{
+		Offsets[Child] = Running;
+		Running += Counts[Child];
+	}
+	for (int32 Index = FirstBody; Index < FirstBody + NumBodies; ++Index)
+	{
+		Scratch[Offsets[Octant(Bodies[Index].Position)]++] = Bodies[Index];
+	}
+	FMemory::Memcpy(&Bodies[FirstBody], &Scratch[FirstBody], NumBodies * sizeof(FBody));
+
+	const double ChildHalfSize = Nodes[NodeIndex].HalfSize * 0.5;
+	const int32 FirstChild = Nodes.Num();
+	int32 NumChildren = 0;
+	int32 ChildFirstBody = FirstBody;
+	for (int32 Child = 0; Child < 8; ++Child)
+	{
+		if (Counts[Child] == 0) continue;
+		FNode& ChildNode = Nodes.AddDefaulted_GetRef();
+		ChildNode.Center = Center + FVector((Child & 1) ? ChildHalfSize : -ChildHalfSize, (Child & 2) ? ChildHalfSize : -ChildHalfSize, (Child & 4) ? ChildHalfSize : -ChildHalfSize);
+		ChildNode.HalfSize = ChildHalfSize;
+		ChildNode.FirstBody = ChildFirstBody;
+		ChildNode.NumBodies = Counts[Child];
+		ChildFirstBody += Counts[Child];
+		NumChildren++;
+	}
+	Nodes[NodeIndex].FirstChild = FirstChild;
+	Nodes[NodeIndex].NumChildren = NumChildren;
+
+	for (int32 Child = FirstChild; Child < FirstChild + NumChildren; ++Child)
+	{
+		BuildNode(Child, Depth + 1);
+	}
+}
+
+FVector FGravityBarnesHutTree::Evaluate(const FVector& Position, int32 ExcludeKey, double Theta, double GravitationalConstant, double Softening) const
+{
+	FVector Acceleration = FVector::ZeroVector;
+	if (Nodes.Num() == 0) return Acceleration;
+
+	const double SofteningSquared = Softening * Softening;
+	const double ThetaSquared = Theta * Theta;
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+		if (Node.FirstChild == INDEX_NONE)
+		{
+			for (int32 Index = Node.FirstBody; Index < Node.FirstBody + Node.NumBodies; ++Index)
+			{
+				const FBody& Body = Bodies[Index];
+				if (Body.Key != ExcludeKey || ExcludeKey == INDEX_NONE)
+				{
+					Acceleration += PointAcceleration(Position, Body.Position, Body.Mass, GravitationalConstant, SofteningSquared);
+				}
+			}
+			continue;
+		}
+
+		//Far enough away to treat as a single mass, cells holding the sampled object are always opened since it sits inside them
+		const double CellSize = Node.HalfSize * 2.0;
+		if (CellSize * CellSize < ThetaSquared * FVector::DistSquared(Position, Node.CenterOfMass)
+			&& !FBox(Node.Center - FVector(Node.HalfSize), Node.Center + FVector(Node.HalfSize)).IsInside(Position))
+		{
+			Acceleration += PointAcceleration(Position, Node.CenterOfMass, Node.Mass, GravitationalConstant, SofteningSquared);
+			continue;
+		}
+		for (int32 Child = Node.FirstChild; Child < Node.FirstChild + Node.NumChildren; ++Child)
+		{
+			Stack.Add(Child);
+		}
+	}
+	return Acceleration;
+}
+
+FVector FGravityBarnesHutTree::EvaluateBruteForce(const FVector& Position, int32 ExcludeKey, double GravitationalConstant, double Softening) const
+{
+	const double SofteningSquared = Softening * Softening;
+	FVector Acceleration = FVector::ZeroVector;
+	for (const FBody& Body : Bodies)
+	{
+		if (Body.Key != ExcludeKey || ExcludeKey == INDEX_NONE)
+		{
+			Acceleration += PointAcceleration(Position, Body.Position, Body.Mass, GravitationalConstant, SofteningSquared);
+		}
+	}
+	return Acceleration;
+}
@@ -1,55 +1,63 @@
 #include "GravityController.h"
+#include "GravityFrameComponent.h"
+#include "GravityMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
-void AGravityController::UpdateRotation(float DeltaTime)
+void AGravityController::SetPawn(APawn* InPawn)
 {
-    FVector GravityDirection = FVector::DownVector;
-    if (ACharacter* PlayerCharacter = Cast<ACharacter>(GetPawn()))
+    Super::SetPawn(InPawn);
+
+    // Share the pawn's gravity frame with its camera and movement, adding one for pawns that were not set up with it
+    GravityFrame = nullptr;
+    if (InPawn)
     {
-        if (UCharacterMovementComponent* MoveComp = PlayerCharacter->GetCharacterMovement())
+        GravityFrame = InPawn->FindComponentByClass<UGravityFrameComponent>();
+        if (!GravityFrame)
+        {
+            GravityFrame = NewObject<UGravityFrameComponent>(InPawn, TEXT("GravityFrame"));
+            GravityFrame->SmoothingTime = DeltaSmoothing;
+            GravityFrame->RegisterComponent();
+        }
+
+        // Gravity movement orients the capsule by the same frame the view is built from
+        if (UGravityMovementComponent* GravityMovement = Cast<UGravityMovementComponent>(InPawn->GetMovementComponent()))
         {
-            if (MoveComp->IsFalling()) {
-                GravityDirection = FMath::Lerp(LastFrameGravity, MoveComp->GetGravityDirection(), DeltaTime * 1 / DeltaSmoothing);
-            } else {
-                GravityDirection = LastFrameGravity;
-            }
+            GravityMovement->SetGravityFrame(GravityFrame);
         }
     }
+}
 
+void AGravityController::UpdateRotation(float DeltaTime)
+{
     // Get the current control rotation in world space
     FRotator ViewRotation = GetControlRotation();
     Pitch += RotationInput.Pitch;
     Pitch = FMath::Clamp(Pitch, -MaxPitch, MaxPitch);
-    if (!LastFrameGravity.Equals(GravityDirection))
-    {
-        const FQuat CurrentRotationQuat = FQuat::FindBetweenNormals(LastFrameGravity, GravityDirection);
-        FQuat TargetRotationQuat = CurrentRotationQuat * FQuat(ViewRotation);
 
-        // Interpolate using Slerp for smooth transition
-        FQuat SmoothedRotation = FQuat::Slerp(FQuat(ViewRotation), TargetRotationQuat, DeltaTime);
-        ViewRotation = SmoothedRotation.Rotator();
+    // Carry the view along with whatever rotation the gravity frame went through this frame, then convert it to gravity relative space
+    if (GravityFrame)
+    {
+        GravityFrame->Advance(DeltaTime);
+        if (!GravityFrame->GetFrameDelta().Equals(FQuat::Identity))
+        {
+            ViewRotation = (GravityFrame->GetFrameDelta() * ViewRotation.Quaternion()).Rotator();
+        }
+        ViewRotation = GravityFrame->ToGravityRelative(ViewRotation);
     }
 
-    LastFrameGravity = GravityDirection;
-
-    // Convert the view rotation from world space to gravity relative space
-    ViewRotation = GetGravityRelativeRotation(ViewRotation, GravityDirection);
-
     FRotator DeltaRot(RotationInput);
 
     if (PlayerCameraManager)
     {
-        ACharacter* PlayerCharacter = Cast<ACharacter>(GetPawn());
-
         // Keep the camera roll level with gravity
         ViewRotation.Roll = 0;
         ViewRotation.Pitch = Pitch;
 
         // Convert back to world space
         PlayerCameraManager->ProcessViewRotation(DeltaTime, ViewRotation, DeltaRot);
-        SetControlRotation(GetGravityWorldRotation(ViewRotation, GravityDirection));
+        SetControlRotation(GravityFrame ? GravityFrame->ToWorld(ViewRotation) : ViewRotation);
     }
 
     APawn* const P = GetPawnOrSpectator();
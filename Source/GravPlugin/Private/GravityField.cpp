@@ -0,0 +1,90 @@
+// --- GravityField.cpp ---
+#include "GravityField.h"
+#include "Math/Float16.h"
+
+void FGravityFieldParams::EvaluateBatch(int32 Priority, const double* X, const double* Y, const double* Z, const double* LanePriority,
+	double* OutX, double* OutY, double* OutZ, int32 Num) const
+{
+	if (Type != EGravityFieldType::BakedGrid)
+	{
+		//Vector path of GravPluginLibrary, scalar for the remainder lanes and exponents without a vector form
+		GravKernel::EvaluateBatch(ToKernel(), Priority, X, Y, Z, LanePriority, OutX, OutY, OutZ, Num);
+		return;
+	}
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const FVector Gravity = !LanePriority || LanePriority[Index] <= double(Priority) ? Evaluate(FVector(X[Index], Y[Index], Z[Index])) : FVector::ZeroVector;
+		OutX[Index] = Gravity.X;
+		OutY[Index] = Gravity.Y;
+		OutZ[Index] = Gravity.Z;
+	}
+}
+
+FBox FGravityZoneVolume::GetBounds() const
+{
+	if (Shape == EShape::Sphere)
+	{
+		return FBox(Center - FVector(Extent.X), Center + FVector(Extent.X));
+	}
+
+	FVector LocalExtent = Extent;
+	if (Shape == EShape::Capsule)
+	{
+		LocalExtent = FVector(Extent.X, Extent.X, FMath::Max(Extent.Z, Extent.X));
+	}
+	const FVector WorldExtent = FBox(-LocalExtent, LocalExtent).TransformBy(FTransform(Rotation)).GetExtent();
+	return FBox(Center - WorldExtent, Center + WorldExtent);
+}
+
+// --- Baked Grid ---
+FVector FGravityFieldGrid::Sample(const FVector& LocalPosition) const
+{
+	if (!IsValid()) return FVector::ZeroVector;
+
+	const FVector Cell = (LocalPosition - FVector(Origin)) / VoxelSize;
+	const FIntVector NumSamples = NumBricks * BrickSize;
+	if (Cell.X < 0.0 || Cell.Y < 0.0 || Cell.Z < 0.0
+		|| Cell.X > NumSamples.X - 1 || Cell.Y > NumSamples.Y - 1 || Cell.Z > NumSamples.Z - 1)
+	{
+		return FVector::ZeroVector;
+	}
+
+	const int32 X = FMath::Min(FMath::FloorToInt32(Cell.X), NumSamples.X - 2);
+	const int32 Y = FMath::Min(FMath::FloorToInt32(Cell.Y), NumSamples.Y - 2);
+	const int32 Z = FMath::Min(FMath::FloorToInt32(Cell.Z), NumSamples.Z - 2);
+	const float FX = float(Cell.X - X);
+	const float FY = float(Cell.Y - Y);
+	const float FZ = float(Cell.Z - Z);
+
+	const FVector3f C00 = FMath::Lerp(FetchSample(X, Y, Z), FetchSample(X + 1, Y, Z), FX);
+	const FVector3f C10 = FMath::Lerp(FetchSample(X, Y + 1, Z), FetchSample(X + 1, Y + 1, Z), FX);
+	const FVector3f C01 = FMath::Lerp(FetchSample(X, Y, Z + 1), FetchSample(X + 1, Y, Z + 1), FX);
+	const FVector3f C11 = FMath::Lerp(FetchSample(X, Y + 1, Z + 1), FetchSample(X + 1, Y + 1, Z + 1), FX);
+	return FVector(FMath::Lerp(FMath::Lerp(C00, C10, FY), FMath::Lerp(C01, C11, FY), FZ));
+}
+
+FVector3f FGravityFieldGrid::FetchSample(int32 X, int32 Y, int32 Z) const
+{
+	const int32 BrickIndex = (X / BrickSize) + NumBricks.X * ((Y / BrickSize) + NumBricks.Y * (Z / BrickSize));
+	const int32 Entry = BrickTable[BrickIndex];
+	if (Entry < 0)
+	{
+		return Decode(&ConstantData[(-Entry - 1) * 3]);
+	}
+	const int32 Local = (X % BrickSize) + BrickSize * ((Y % BrickSize) + BrickSize * (Z % BrickSize));
+	return Decode(&BrickData[(Entry * BrickSamples + Local) * 3]);
+}
+
+FVector3f FGravityFieldGrid::Decode(const uint16* Encoded) const
+{
+	if (Precision == EGravityFieldPrecision::Half)
+	{
+		FFloat16 X, Y, Z;
+		X.Encoded = Encoded[0];
+		Y.Encoded = Encoded[1];
+		Z.Encoded = Encoded[2];
+		return FVector3f(X.GetFloat(), Y.GetFloat(), Z.GetFloat());
+	}
+	return FVector3f(int16(Encoded[0]), int16(Encoded[1]), int16(Encoded[2])) * QuantizationScale;
+}
@@ -0,0 +1,190 @@
+// --- GravityFieldAsset.cpp ---
+#include "GravityFieldAsset.h"
+#include "GravityStats.h"
+
+#if WITH_EDITOR
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "Math/Float16.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace GravityFieldBake
+{
+	void Encode(const FVector3f& Value, EGravityFieldPrecision Precision, float QuantizationScale, uint16* OutEncoded)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (Precision == EGravityFieldPrecision::Half)
+			{
+				OutEncoded[Axis] = FFloat16(Value[Axis]).Encoded;
+			}
+			else
+			{
+				OutEncoded[Axis] = uint16(int16(FMath::Clamp(FMath::RoundToInt32(Value[Axis] / QuantizationScale), -MAX_int16, MAX_int16)));
+			}
+		}
+	}
+}
+
+void UGravityFieldAsset::Bake()
+{
+	using namespace GravityFieldBake;
+	constexpr int32 BrickSize = FGravityFieldGrid::BrickSize;
+	constexpr int32 BrickSamples = FGravityFieldGrid::BrickSamples;
+
+	TArray<FGravityPointMass> Masses = PointMasses;
+	AppendMeshPointMasses(Masses);
+
+	FGravityFieldGrid NewGrid;
+	NewGrid.Origin = FVector3f(-Extent);
+	NewGrid.VoxelSize = VoxelSize;
+	NewGrid.Precision = Precision;
+	NewGrid.NumBricks = FIntVector(
+		FMath::Max(FMath::CeilToInt32((2.0 * Extent.X / VoxelSize + 1.0) / BrickSize), 1),
+		FMath::Max(FMath::CeilToInt32((2.0 * Extent.Y / VoxelSize + 1.0) / BrickSize), 1),
+		FMath::Max(FMath::CeilToInt32((2.0 * Extent.Z / VoxelSize + 1.0) / BrickSize), 1));
+	const int32 NumBricks = NewGrid.NumBricks.X * NewGrid.NumBricks.Y * NewGrid.NumBricks.Z;
+
+	//Direct sum over every mass, softened by a voxel so samples next to a mass stay finite
+	const double Softening = FMath::Square(double(VoxelSize));
+	TArray<FVector3f> Samples;
+	Samples.SetNumUninitialized(NumBricks * BrickSamples);
+	ParallelFor(TEXT("GravityFieldAsset.Bake"), NumBricks, 1, [&](int32 BrickIndex)
+	{
+		const FIntVector Brick(
+			BrickIndex % NewGrid.NumBricks.X,
+			(BrickIndex / NewGrid.NumBricks.X) % NewGrid.NumBricks.Y,
+			BrickIndex / (NewGrid.NumBricks.X * NewGrid.NumBricks.Y));
+		for (int32 Local = 0; Local < BrickSamples; ++Local)
+		{
+			const FIntVector Voxel = Brick * BrickSize + FIntVector(Local % BrickSize, (Local / BrickSize) % BrickSize, Local / (BrickSize * BrickSize));
+			const FVector Position = FVector(NewGrid.Origin) + FVector(Voxel) * VoxelSize;
+			FVector Gravity = FVector::ZeroVector;
+			for (const FGravityPointMass& PointMass : Masses)
+			{
+				const FVector ToMass = PointMass.Location - Position;
+				const double DistanceSquared = ToMass.SizeSquared() + Softening;
+				Gravity += ToMass * (GravitationalConstant * PointMass.Mass / (DistanceSquared * FMath::Sqrt(DistanceSquared)));
+			}
+			Samples[BrickIndex * BrickSamples + Local] = FVector3f(Gravity);
+		}
+	});
+
+	float MaxComponent = 0.f;
+	for (const FVector3f& Sample : Samples)
+	{
+		MaxComponent = FMath::Max(MaxComponent, Sample.GetAbsMax());
+	}
+	NewGrid.QuantizationScale = MaxComponent > 0.f ? MaxComponent / MAX_int16 : 1.f;
+
+	//Collapse bricks that are flat within tolerance, everything else is stored in full
+	NewGrid.BrickTable.SetNumUninitialized(NumBricks);
+	for (int32 BrickIndex = 0; BrickIndex < NumBricks; ++BrickIndex)
+	{
+		const TConstArrayView<FVector3f> BrickValues(&Samples[BrickIndex * BrickSamples], BrickSamples);
+		FVector3f Mean = FVector3f::ZeroVector;
+		for (const FVector3f& Value : BrickValues)
+		{
+			Mean += Value;
+		}
+		Mean /= BrickSamples;
+
+		bool bConstant = true;
+		for (const FVector3f& Value : BrickValues)
+		{
+			if (FVector3f::DistSquared(Value, Mean) > FMath::Square(ConstantBrickTolerance))
+			{
+				bConstant = false;
+				break;
+			}
+		}
+
+		if (bConstant)
+		{
+			const int32 ConstantIndex = NewGrid.ConstantData.Num() / 3;
+			NewGrid.ConstantData.AddUninitialized(3);
+			Encode(Mean, Precision, NewGrid.QuantizationScale, &NewGrid.ConstantData[ConstantIndex * 3]);
+			NewGrid.BrickTable[BrickIndex] = -(ConstantIndex + 1);
+		}
+		else
+		{
+			const int32 DataIndex = NewGrid.BrickData.Num() / (BrickSamples * 3);
+			NewGrid.BrickData.AddUninitialized(BrickSamples * 3);
+			for (int32 Local = 0; Local < BrickSamples; ++Local)
+			{
+				Encode(BrickValues[Local], Precision, NewGrid.QuantizationScale, &NewGrid.BrickData[(DataIndex * BrickSamples + Local) * 3]);
+			}
+			NewGrid.BrickTable[BrickIndex] = DataIndex;
+		}
+	}
+
+	Modify();
+	Grid = MoveTemp(NewGrid);
+	UpdateSharedGrid();
+	MarkPackageDirty();
+	UE_LOG(LogGravity, Log, TEXT("Baked %s: %d point masses, %d bricks (%d stored, %d constant), %lld bytes"), *GetName(), Masses.Num(),
+		NumBricks, Grid.BrickData.Num() / (BrickSamples * 3), Grid.ConstantData.Num() / 3, Grid.GetDataSize());
+}
+
+void UGravityFieldAsset::AppendMeshPointMasses(TArray<FGravityPointMass>& OutPointMasses) const
+{
+	const UStaticMesh* Mesh = SourceMesh.LoadSynchronous();
+	const UBodySetup* BodySetup = Mesh ? Mesh->GetBodySetup() : nullptr;
+	if (!Mesh) return;
+	if (!BodySetup || BodySetup->AggGeom.GetElementCount() == 0)
+	{
+		UE_LOG(LogGravity, Warning, TEXT("%s: %s has no simple collision, the mesh adds no mass to the bake"), *GetName(), *Mesh->GetName());
+		return;
+	}
+
+	//Fill the simple collision with evenly spaced masses, points inside report a distance of zero
+	const FBox Bounds = Mesh->GetBoundingBox();
+	const double CellMass = MeshDensity * FMath::Cube(double(MeshSampleSpacing));
+	bool bQueryFailed = false;
+	for (double X = Bounds.Min.X + MeshSampleSpacing * 0.5; X < Bounds.Max.X; X += MeshSampleSpacing)
+	{
+		for (double Y = Bounds.Min.Y + MeshSampleSpacing * 0.5; Y < Bounds.Max.Y; Y += MeshSampleSpacing)
+		{
+			for (double Z = Bounds.Min.Z + MeshSampleSpacing * 0.5; Z < Bounds.Max.Z; Z += MeshSampleSpacing)
+			{
+				const FVector Position(X, Y, Z);
+				//A negative distance means the query failed, not that the point is inside
+				const float Distance = BodySetup->GetShortestDistanceToPoint(Position, FTransform::Identity);
+				bQueryFailed |= Distance < 0.f;
+				if (Distance == 0.f)
+				{
+					OutPointMasses.Add({ Position, CellMass });
+				}
+			}
+		}
+	}
+
+	if (bQueryFailed)
+	{
+		UE_LOG(LogGravity, Warning, TEXT("%s: distance queries against the simple collision of %s failed, give it box, sphere, capsule or convex shapes"), *GetName(), *Mesh->GetName());
+	}
+}
+#endif
+
+void UGravityFieldAsset::PostLoad()
+{
+	Super::PostLoad();
+	UpdateSharedGrid();
+}
+
+void UGravityFieldAsset::UpdateSharedGrid()
+{
+#if WITH_EDITORONLY_DATA
+	SharedGrid.Reset();
+	if (Grid.IsValid())
+	{
+		SharedGrid = MakeShared<FGravityFieldGrid, ESPMode::ThreadSafe>(Grid);
+	}
+#else
+	//Cooked assets are never saved again, so the samples move instead of being held twice
+	if (Grid.IsValid())
+	{
+		SharedGrid = MakeShared<FGravityFieldGrid, ESPMode::ThreadSafe>(MoveTemp(Grid));
+	}
+#endif
+}
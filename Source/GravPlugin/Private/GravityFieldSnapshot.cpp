@@ -0,0 +1,165 @@
+// --- GravityFieldSnapshot.cpp ---
+#include "GravityFieldSnapshot.h"
+
+void FGravityFieldSnapshot::Reset()
+{
+	Zones.Reset();
+	Volumes.Reset();
+	BoundsNodes.Reset();
+	NodeZones.Reset();
+}
+
+void FGravityFieldSnapshot::BuildBoundsHierarchy()
+{
+	BoundsNodes.Reset();
+	NodeZones.Reset();
+
+	//Zones without a shape contain nothing and stay out of the hierarchy
+	for (int32 ZoneIndex = 0; ZoneIndex < Zones.Num(); ++ZoneIndex)
+	{
+		if (Zones[ZoneIndex].NumVolumes > 0)
+		{
+			NodeZones.Add(ZoneIndex);
+		}
+	}
+	if (NodeZones.Num() == 0) return;
+
+	FBoundsNode& Root = BoundsNodes.AddDefaulted_GetRef();
+	Root.NumZones = NodeZones.Num();
+	BuildBoundsNode(0);
+}
+
+void FGravityFieldSnapshot::BuildBoundsNode(int32 NodeIndex)
+{
+	const int32 FirstZone = BoundsNodes[NodeIndex].FirstZone;
+	const int32 NumZones = BoundsNodes[NodeIndex].NumZones;
+	FBox Bounds(ForceInit);
+	FBox Centers(ForceInit);
+	for (int32 Slot = FirstZone; Slot < FirstZone + NumZones; ++Slot)
+	{
+		const FBox& ZoneBounds = Zones[NodeZones[Slot]].Bounds;
+		Bounds += ZoneBounds;
+		Centers += ZoneBounds.GetCenter();
+	}
+	BoundsNodes[NodeIndex].Bounds = Bounds;
+	if (NumZones <= MaxLeafZones) return;
+
+	//Median split along the axis the zone centers spread furthest on, so the depth stays logarithmic however zones cluster
+	const FVector Spread = Centers.GetSize();
+	const int32 Axis = Spread.X >= Spread.Y && Spread.X >= Spread.Z ? 0 : (Spread.Y >= Spread.Z ? 1 : 2);
+	MakeArrayView(&NodeZones[FirstZone], NumZones).Sort([this, Axis](int32 A, int32 B)
+	{
+		return Zones[A].Bounds.GetCenter()[Axis] < Zones[B].Bounds.GetCenter()[Axis];
+	});
+
+	//Adding the children may reallocate the nodes, so they are only touched by index from here on
+	const int32 FirstChild = BoundsNodes.Num();
+	const int32 NumLeft = NumZones / 2;
+	BoundsNodes.AddDefaulted(2);
+	BoundsNodes[NodeIndex].FirstChild = FirstChild;
+	BoundsNodes[FirstChild].FirstZone = FirstZone;
+	BoundsNodes[FirstChild].NumZones = NumLeft;
+	BoundsNodes[FirstChild + 1].FirstZone = FirstZone + NumLeft;
+	BoundsNodes[FirstChild + 1].NumZones = NumZones - NumLeft;
+	BuildBoundsNode(FirstChild);
+	BuildBoundsNode(FirstChild + 1);
+}
+
+bool FGravityFieldSnapshot::ZoneContains(int32 ZoneIndex, const FVector& Position) const
+{
+	const FZone& Zone = Zones[ZoneIndex];
+	if (!Zone.Bounds.IsInsideOrOn(Position)) return false;
+	for (int32 VolumeIndex = Zone.FirstVolume; VolumeIndex < Zone.FirstVolume + Zone.NumVolumes; ++VolumeIndex)
+	{
+		if (Volumes[VolumeIndex].Contains(Position))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FGravityFieldSnapshot::SampleBatch(TConstArrayView<FVector> Positions, TArrayView<FVector> OutGravity, TArrayView<FVector2f> OutDamping, FBatchScratch& Scratch) const
+{
+	const int32 NumPositions = Positions.Num();
+	const bool bDamping = OutDamping.Num() > 0;
+	check(OutGravity.Num() >= NumPositions && (!bDamping || OutDamping.Num() >= NumPositions));
+
+	//Membership pass, damping takes the max over every zone. Gravity batches every zone too and leaves the priority
+	//rule to the kernel
+	Scratch.ZoneLaneCounts.Reset();
+	Scratch.ZoneLaneCounts.SetNumZeroed(Zones.Num());
+	Scratch.EntityZones.Reset();
+	Scratch.EntityZoneCounts.SetNumUninitialized(NumPositions, EAllowShrinking::No);
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		const FVector& Position = Positions[Index];
+		FVector2f Damping = FVector2f::ZeroVector;
+		const int32 FirstZone = Scratch.EntityZones.Num();
+		ForEachZoneAt(Position, [&](int32 ZoneIndex)
+		{
+			const FZone& Zone = Zones[ZoneIndex];
+			Damping.X = FMath::Max(Damping.X, Zone.LinearDamping);
+			Damping.Y = FMath::Max(Damping.Y, Zone.AngularDamping);
+			Scratch.EntityZones.Add(ZoneIndex);
+		});
+		Scratch.EntityZoneCounts[Index] = Scratch.EntityZones.Num() - FirstZone;
+		for (int32 Slot = FirstZone; Slot < Scratch.EntityZones.Num(); ++Slot)
+		{
+			Scratch.ZoneLaneCounts[Scratch.EntityZones[Slot]]++;
+		}
+		OutGravity[Index] = FVector::ZeroVector;
+		if (bDamping)
+		{
+			OutDamping[Index] = Damping;
+		}
+	}
+
+	//Lay the lanes out contiguously per zone
+	const int32 NumLanes = Scratch.EntityZones.Num();
+	Scratch.ZoneLaneStarts.SetNumUninitialized(Zones.Num(), EAllowShrinking::No);
+	int32 Running = 0;
+	for (int32 ZoneIndex = 0; ZoneIndex < Zones.Num(); ++ZoneIndex)
+	{
+		Scratch.ZoneLaneStarts[ZoneIndex] = Running;
+		Running += Scratch.ZoneLaneCounts[ZoneIndex];
+		Scratch.ZoneLaneCounts[ZoneIndex] = 0; //Reused as the fill cursor
+	}
+	Scratch.LaneEntities.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	for (TArray<double>* Array : { &Scratch.X, &Scratch.Y, &Scratch.Z, &Scratch.Priority, &Scratch.OutX, &Scratch.OutY, &Scratch.OutZ })
+	{
+		Array->SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	}
+
+	int32 Slot = 0;
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		for (int32 Count = 0; Count < Scratch.EntityZoneCounts[Index]; ++Count, ++Slot)
+		{
+			const int32 ZoneIndex = Scratch.EntityZones[Slot];
+			const int32 Lane = Scratch.ZoneLaneStarts[ZoneIndex] + Scratch.ZoneLaneCounts[ZoneIndex]++;
+			Scratch.X[Lane] = Positions[Index].X;
+			Scratch.Y[Lane] = Positions[Index].Y;
+			Scratch.Z[Lane] = Positions[Index].Z;
+			Scratch.Priority[Lane] = Zones[ZoneIndex].Priority;
+			Scratch.LaneEntities[Lane] = Index;
+		}
+	}
+
+	//Lanes of zones below their position's highest priority are masked to zero, so summing per position applies the rule
+	Scratch.EntityPriority.Init(GravKernel::LowestPriority, NumPositions);
+	GravKernel::ResolvePriorities(Scratch.LaneEntities.GetData(), Scratch.Priority.GetData(), Scratch.EntityPriority.GetData(), NumLanes);
+
+	for (int32 ZoneIndex = 0; ZoneIndex < Zones.Num(); ++ZoneIndex)
+	{
+		const int32 Start = Scratch.ZoneLaneStarts[ZoneIndex];
+		const int32 Num = Scratch.ZoneLaneCounts[ZoneIndex];
+		if (Num == 0) continue;
+		Zones[ZoneIndex].Field.EvaluateBatch(Zones[ZoneIndex].Priority, &Scratch.X[Start], &Scratch.Y[Start], &Scratch.Z[Start], &Scratch.Priority[Start],
+			&Scratch.OutX[Start], &Scratch.OutY[Start], &Scratch.OutZ[Start], Num);
+		for (int32 Lane = Start; Lane < Start + Num; ++Lane)
+		{
+			OutGravity[Scratch.LaneEntities[Lane]] += FVector(Scratch.OutX[Lane], Scratch.OutY[Lane], Scratch.OutZ[Lane]);
+		}
+	}
+}
@@ -0,0 +1,86 @@
+// --- GravityFrameComponent.cpp ---
+#include "GravityFrameComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UGravityFrameComponent::UGravityFrameComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+	SmoothingTime = 0.1f;
+	bOnlyBlendWhileFalling = true;
+}
+
+void UGravityFrameComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (const ACharacter* Character = Cast<ACharacter>(GetOwner()))
+	{
+		MovementComp = Character->GetCharacterMovement();
+	}
+	SnapToDirection(MovementComp ? MovementComp->GetGravityDirection() : FVector::DownVector);
+}
+
+void UGravityFrameComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Advance(DeltaTime);
+}
+
+void UGravityFrameComponent::SnapToDirection(FVector NewDirection)
+{
+	Direction = NewDirection.GetSafeNormal(UE_SMALL_NUMBER, FVector::DownVector);
+	GravityToWorld = FQuat::FindBetweenNormals(FVector::DownVector, Direction);
+	FrameDelta = FQuat::Identity;
+	AngularSpeed = 0.0;
+}
+
+void UGravityFrameComponent::Advance(float DeltaTime)
+{
+	if (LastAdvanceFrame == GFrameCounter) return;
+	LastAdvanceFrame = GFrameCounter;
+	FrameDelta = FQuat::Identity;
+
+	if (!MovementComp)
+	{
+		AngularSpeed = 0.0;
+		return;
+	}
+
+	const FVector Target = MovementComp->GetGravityDirection();
+	const double Angle = FMath::Acos(FMath::Clamp(Direction | Target, -1.0, 1.0));
+	if (Angle <= UE_KINDA_SMALL_NUMBER)
+	{
+		AngularSpeed = 0.0;
+		return;
+	}
+
+	//Closed form critically damped spring on the remaining angle, exact for any step length. The rate is
+	//chosen so about 90% of a change is covered after SmoothingTime
+	double Remaining = 0.0;
+	const bool bSmooth = !bOnlyBlendWhileFalling || MovementComp->IsFalling();
+	if (bSmooth && SmoothingTime > 0.f && DeltaTime > 0.f)
+	{
+		const double Omega = 4.0 / SmoothingTime;
+		const double Decay = FMath::Exp(-Omega * DeltaTime);
+		const double Rate = -AngularSpeed;
+		const double Temp = (Rate + Omega * Angle) * DeltaTime;
+		Remaining = FMath::Clamp((Angle + Temp) * Decay, 0.0, Angle);
+		AngularSpeed = -(Rate - Omega * Temp) * Decay;
+	}
+	else
+	{
+		AngularSpeed = 0.0;
+	}
+
+	//Rotate along the great circle towards the target, picking any perpendicular axis when gravity flips outright
+	FVector Axis = Direction ^ Target;
+	if (!Axis.Normalize())
+	{
+		FVector Unused;
+		Direction.FindBestAxisVectors(Axis, Unused);
+	}
+	FrameDelta = FQuat(Axis, Angle - Remaining);
+	Direction = FrameDelta.RotateVector(Direction).GetSafeNormal(UE_SMALL_NUMBER, Target);
+	GravityToWorld = (FrameDelta * GravityToWorld).GetNormalized();
+}
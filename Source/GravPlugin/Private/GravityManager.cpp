@@ -1,21 +1,37 @@
 // --- GravityManager.cpp ---
 #include "GravityManager.h"
 #include "GravityZone.h"
+#include "GravityStats.h"
+#include "GravitySourceComponent.h"
+#include "GravityReplicationProxy.h"
+#include "GravityMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "Engine/OverlapResult.h"
+#include "GameFramework/PlayerController.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "GravitySimCallback.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
 
 // --- Subsystem Lifecycle ---
 void UGravityManager::Initialize(FSubsystemCollectionBase& Collection) // Make sure this matches your class name
 {
 	Super::Initialize(Collection);
+	PhysicsCreatedHandle = UActorComponent::GlobalCreatePhysicsDelegate.AddUObject(this, &UGravityManager::OnComponentPhysicsStateChanged);
+	PhysicsDestroyedHandle = UActorComponent::GlobalDestroyPhysicsDelegate.AddUObject(this, &UGravityManager::OnComponentPhysicsStateChanged);
 	if (UWorld* World = GetWorld())
 	{
-		for (AGravityZone* Zone : RegisteredGravityZones)
+		for (const FZoneSlot& ZoneSlot : ZoneSlots)
 		{
-			if (Zone)
+			if (AGravityZone* Zone = ZoneSlot.Zone)
 			{
 				TArray<AActor*> OverlappingActors;
 				Zone->GetOverlappingActors(OverlappingActors);
@@ -26,266 +42,1892 @@ void UGravityManager::Initialize(FSubsystemCollectionBase& Collection) // Make s
 			}
 		}
 	}
-	UE_LOG(LogTemp, Log, TEXT("GravityManager Initialized")); // Use your class name in logs
+	UE_LOG(LogGravity, Log, TEXT("GravityManager Initialized"));
 }
 
 void UGravityManager::Deinitialize() // Make sure this matches your class name
 {
-	UE_LOG(LogTemp, Log, TEXT("GravityManager Deinitialized")); // Use your class name in logs
-	RegisteredGravityZones.Empty();
-	ActorZoneOverlaps.Empty();
+	UE_LOG(LogGravity, Log, TEXT("GravityManager Deinitialized"));
+	UActorComponent::GlobalCreatePhysicsDelegate.Remove(PhysicsCreatedHandle);
+	UActorComponent::GlobalDestroyPhysicsDelegate.Remove(PhysicsDestroyedHandle);
+	UnregisterSimCallback();
+	UE::Tasks::Wait(TrajectoryTasks);
+	TrajectoryTasks.Empty();
+	ZoneOnboardingTask.Wait();
+	ZoneOnboarding.Reset();
+	PendingZones.Empty();
+	for (FZoneSlot& ZoneSlot : ZoneSlots)
+	{
+		if (ZoneSlot.Zone)
+		{
+			ZoneSlot.Zone->ManagerHandle.Reset();
+			ZoneSlot.Zone->OctreeId = FOctreeElementId2();
+		}
+	}
+	ZoneSlots.Empty();
+	FreeZoneSlots.Empty();
+	ZoneOctree.Destroy();
+	GravitySources.Empty();
+	SourceTree.Reset();
+	ActorSlots.Empty();
+	ActorSlotIndices.Empty();
+	for (FGravityGroup& Group : GravityGroups)
+	{
+		Group = FGravityGroup();
+	}
 	Super::Deinitialize();
 }
 
-bool UGravityManager::ShouldCreateSubsystem(UObject* Outer) const // Make sure this matches your class name
+bool UGravityManager::ShouldCreateSubsystem(UObject* Outer) const // Make sure this matches your class name
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+// --- Gravity Zone Management ---
+void UGravityManager::RegisterGravityZone(AGravityZone* GravityZone) // Make sure this matches your class name
+{
+	if (GravityZone)
+	{
+		const int32 ZoneIndex = FindOrAddZoneSlot(GravityZone);
+		if (UseDeferredZoneRegistration)
+		{
+			//The actors already inside are found by the next onboarding pass together with every other new zone
+			PendingZones.Add({ ZoneIndex, ZoneSlots[ZoneIndex].Generation });
+		}
+		else
+		{
+			TArray<AActor*> OverlappingActors;
+			GravityZone->GetOverlappingActors(OverlappingActors);
+			for (AActor* OverlappingActor : OverlappingActors)
+			{
+				NotifyObjectEnteredZone(OverlappingActor, GravityZone);
+			}
+		}
+		UE_LOG(LogGravity, Verbose, TEXT("Registered Gravity Zone: %s"), *GravityZone->GetName());
+	}
+}
+void UGravityManager::UnregisterGravityZone(AGravityZone* GravityZone) // Make sure this matches your class name
+{
+	if (GravityZone)
+	{
+		const int32 ZoneIndex = FindZoneSlot(GravityZone);
+		if (ZoneIndex != INDEX_NONE)
+		{
+			ReleaseZoneSlot(ZoneIndex);
+		}
+		UE_LOG(LogGravity, Verbose, TEXT("Unregistered Gravity Zone: %s"), *GravityZone->GetName());
+	}
+}
+
+// --- Gravity Source Management ---
+void UGravityManager::RegisterGravitySource(UGravitySourceComponent* GravitySource)
+{
+	if (GravitySource)
+	{
+		GravitySources.AddUnique(GravitySource);
+		AActor* Owner = GravitySource->GetOwner();
+		if (Owner && CanBeAffected(Owner))
+		{
+			//Owners are tracked like zone occupants so the other sources can pull them
+			FActorSlot& ActorSlot = ActorSlots[FindOrAddActorSlot(Owner)];
+			ActorSlot.bOwnsGravitySource = true;
+			ActorSlot.bIgnoreGravitySources = !GravitySource->bAffectedByOtherSources;
+			SyncZoneSet(ActorSlot);
+		}
+	}
+}
+
+void UGravityManager::UnregisterGravitySource(UGravitySourceComponent* GravitySource)
+{
+	GravitySources.RemoveSingleSwap(GravitySource, EAllowShrinking::No);
+	AActor* Owner = GravitySource ? GravitySource->GetOwner() : nullptr;
+	const int32* ActorIndex = Owner ? ActorSlotIndices.Find(Owner) : nullptr;
+	if (!ActorIndex) return;
+
+	//The owner stays a source owner while any of its other sources is registered, without one it is pruned like any zoneless actor
+	FActorSlot& ActorSlot = ActorSlots[*ActorIndex];
+	ActorSlot.bOwnsGravitySource = false;
+	ActorSlot.bIgnoreGravitySources = false;
+	for (const UGravitySourceComponent* OtherSource : GravitySources)
+	{
+		if (OtherSource && OtherSource->GetOwner() == Owner)
+		{
+			ActorSlot.bOwnsGravitySource = true;
+			ActorSlot.bIgnoreGravitySources |= !OtherSource->bAffectedByOtherSources;
+		}
+	}
+	SyncZoneSet(ActorSlot);
+}
+
+FVector UGravityManager::SampleGravitySources(const FVector& Position, AActor* ExcludeOwner) const
+{
+	if (!HasActiveGravitySources()) return FVector::ZeroVector;
+	const int32* OwnerIndex = ExcludeOwner ? ActorSlotIndices.Find(ExcludeOwner) : nullptr;
+	return SourceTree.Evaluate(Position, OwnerIndex ? *OwnerIndex : INDEX_NONE, NBodyTheta, NBodyGravitationalConstant, NBodySoftening);
+}
+
+// --- Replication ---
+void UGravityManager::SetReplicationProxy(AGravityReplicationProxy* Proxy)
+{
+	ReplicationProxy = Proxy;
+}
+
+void UGravityManager::ApplyReplicatedGravity(AActor* AffectedActor, const FVector& Gravity)
+{
+	if (AffectedActor && CanBeAffected(AffectedActor))
+	{
+		FActorSlot& ActorSlot = ActorSlots[FindOrAddActorSlot(AffectedActor)];
+		ActorSlot.bReplicatedGravity = true;
+		ActorSlot.ReplicatedGravity = Gravity;
+		SyncZoneSet(ActorSlot);
+	}
+}
+
+void UGravityManager::ClearReplicatedGravity(AActor* AffectedActor)
+{
+	if (const int32* ActorIndex = AffectedActor ? ActorSlotIndices.Find(AffectedActor) : nullptr)
+	{
+		ActorSlots[*ActorIndex].bReplicatedGravity = false;
+		SyncZoneSet(ActorSlots[*ActorIndex]);
+	}
+}
+
+// Server side, pushes the resolved gravity of every replicated actor processed this tick to the proxy
+void UGravityManager::PublishReplicatedGravity()
+{
+	UWorld* World = GetWorld();
+	const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+	if (!UseReplication || !UseGravity || NetMode == NM_Standalone || NetMode == NM_Client) return;
+
+	AGravityReplicationProxy* Proxy = ReplicationProxy.Get();
+	if (!Proxy)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		Proxy = World->SpawnActor<AGravityReplicationProxy>(SpawnParams);
+		ReplicationProxy = Proxy;
+		if (!Proxy) return;
+	}
+
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
+	{
+		const FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		const FActorSnapshot& Snapshot = ActorSnapshots[ActorIndex];
+		if (Snapshot.bSkip || !ActorSlot.Actor->GetIsReplicated()) continue;
+
+		AGravityZone* Zone = nullptr;
+		if (ActorSlot.ActiveZones.Num() > 0 && ActorSlot.ActivePriority == Snapshot.HighestPriority)
+		{
+			Zone = ZoneSlots[ActorSlot.ActiveZones[0]].Zone;
+		}
+		Proxy->UpdateActor(ActorSlot.Actor, Snapshot.NetGravity, Zone);
+	}
+}
+
+// --- Field Snapshot ---
+void UGravityManager::PublishFieldSnapshot()
+{
+	//A reader that pinned the back slot just before the last flip is still copying it, keep the current snapshot for another tick
+	const int32 BackIndex = 1 - PublishedFieldSnapshot.load();
+	if (FieldSnapshotReaders[BackIndex].load() != 0) return;
+
+	//Readers hold their own reference, so the back snapshot can only be refilled once nobody else is using it
+	TSharedPtr<FGravityFieldSnapshot, ESPMode::ThreadSafe>& FieldSnapshot = FieldSnapshots[BackIndex];
+	if (!FieldSnapshot.IsValid() || !FieldSnapshot.IsUnique())
+	{
+		FieldSnapshot = MakeShared<FGravityFieldSnapshot, ESPMode::ThreadSafe>();
+	}
+	FieldSnapshot->Reset();
+
+	for (int32 ZoneIndex = 0; ZoneIndex < ZoneSnapshots.Num(); ++ZoneIndex)
+	{
+		const FZoneSnapshot& ZoneSnapshot = ZoneSnapshots[ZoneIndex];
+		if (!ZoneSnapshot.Zone) continue;
+
+		FGravityFieldSnapshot::FZone& Zone = FieldSnapshot->Zones.AddDefaulted_GetRef();
+		Zone.Field = ZoneSnapshot.Field;
+		Zone.Priority = ZoneSnapshot.Priority;
+		Zone.LinearDamping = float(ZoneSnapshot.LinearDamping);
+		Zone.AngularDamping = float(ZoneSnapshot.AngularDamping);
+		Zone.FirstVolume = FieldSnapshot->Volumes.Num();
+		for (const FGravityZoneVolume& Volume : ZoneSlots[ZoneIndex].Volumes)
+		{
+			FieldSnapshot->Volumes.Add(Volume);
+			Zone.Bounds += Volume.GetBounds();
+		}
+		Zone.NumVolumes = FieldSnapshot->Volumes.Num() - Zone.FirstVolume;
+	}
+	FieldSnapshot->BuildBoundsHierarchy();
+	PublishedFieldSnapshot.store(BackIndex);
+}
+
+TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> UGravityManager::GetFieldSnapshot() const
+{
+	//Pin the slot, then confirm it is still the published one. A flip in between means the game thread may be about to refill it
+	for (;;)
+	{
+		const int32 Index = PublishedFieldSnapshot.load();
+		FieldSnapshotReaders[Index].fetch_add(1);
+		if (PublishedFieldSnapshot.load() == Index)
+		{
+			TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> Snapshot = FieldSnapshots[Index];
+			FieldSnapshotReaders[Index].fetch_sub(1);
+			return Snapshot;
+		}
+		FieldSnapshotReaders[Index].fetch_sub(1);
+	}
+}
+
+void UGravityManager::SampleGravity(TConstArrayView<FVector> Positions, TArrayView<FVector> OutGravity) const
+{
+	check(OutGravity.Num() >= Positions.Num());
+	const TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> Snapshot = GetFieldSnapshot();
+	if (!Snapshot.IsValid())
+	{
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			OutGravity[Index] = FVector::ZeroVector;
+		}
+		return;
+	}
+
+	//Working memory is kept per thread so steady callers do not allocate
+	static thread_local FGravityFieldSnapshot::FBatchScratch Scratch;
+	Snapshot->SampleBatch(Positions, OutGravity, TArrayView<FVector2f>(), Scratch);
+}
+
+// --- Trajectory Prediction ---
+void UGravityManager::PredictTrajectories(TConstArrayView<FGravityTrajectoryStart> Starts, const FGravityTrajectoryParams& Params, FGravityTrajectoryBuffer& OutBuffer) const
+{
+	const TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> Snapshot = GetFieldSnapshot();
+	FGravityTrajectoryPredictor Predictor(Snapshot.Get(), GetWorld(), Params);
+	Predictor.ChunkSize = TrajectoryChunkSize;
+	Predictor.bParallel = UseParallelTick;
+	Predictor.Predict(Starts, OutBuffer);
+}
+
+void UGravityManager::PredictTrajectoriesAsync(TArray<FGravityTrajectoryStart> Starts, const FGravityTrajectoryParams& Params, TUniqueFunction<void(const FGravityTrajectoryBuffer&)> OnPredicted)
+{
+	TrajectoryTasks.RemoveAllSwap([](const UE::Tasks::FTask& Task) { return Task.IsCompleted(); }, EAllowShrinking::No);
+
+	//The task holds its own reference to the snapshot, the next tick publishes into a fresh one while it is shared
+	TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> Snapshot = GetFieldSnapshot();
+	FGravityTrajectoryPredictor Predictor(Snapshot.Get(), GetWorld(), Params);
+	Predictor.ChunkSize = TrajectoryChunkSize;
+	Predictor.bParallel = UseParallelTick;
+
+	TrajectoryTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis = TWeakObjectPtr<UGravityManager>(this), Snapshot = MoveTemp(Snapshot), Predictor = MoveTemp(Predictor), Starts = MoveTemp(Starts), OnPredicted = MoveTemp(OnPredicted)]() mutable
+		{
+			TSharedRef<FGravityTrajectoryBuffer, ESPMode::ThreadSafe> Buffer = MakeShared<FGravityTrajectoryBuffer, ESPMode::ThreadSafe>();
+			Predictor.Predict(Starts, *Buffer);
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Buffer, OnPredicted = MoveTemp(OnPredicted)]() mutable
+			{
+				if (WeakThis.IsValid())
+				{
+					OnPredicted(*Buffer);
+				}
+			});
+		}));
+}
+
+void UGravityManager::K2_PredictTrajectories(const TArray<FGravityTrajectoryStart>& Starts, const FGravityTrajectoryParams& Params, TArray<FGravityTrajectory>& OutTrajectories) const
+{
+	FGravityTrajectoryBuffer Buffer;
+	PredictTrajectories(Starts, Params, Buffer);
+	Buffer.ToBlueprint(OutTrajectories);
+}
+
+void UGravityManager::K2_PredictTrajectoriesAsync(const TArray<FGravityTrajectoryStart>& Starts, const FGravityTrajectoryParams& Params, FGravityTrajectoriesPredicted OnPredicted)
+{
+	PredictTrajectoriesAsync(Starts, Params, [OnPredicted](const FGravityTrajectoryBuffer& Buffer)
+	{
+		TArray<FGravityTrajectory> Trajectories;
+		Buffer.ToBlueprint(Trajectories);
+		OnPredicted.ExecuteIfBound(Trajectories);
+	});
+}
+
+// Gathers every live source into the Barnes-Hut tree, keyed by the owner's actor slot
+void UGravityManager::BuildSourceTree()
+{
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityNBodyBuild);
+
+	SourcePositions.Reset();
+	SourceMasses.Reset();
+	SourceKeys.Reset();
+	if (UseGravity && UseNBody)
+	{
+		for (int32 SourceIndex = GravitySources.Num() - 1; SourceIndex >= 0; --SourceIndex)
+		{
+			const UGravitySourceComponent* GravitySource = GravitySources[SourceIndex];
+			if (!IsValid(GravitySource))
+			{
+				GravitySources.RemoveAtSwap(SourceIndex, 1, EAllowShrinking::No);
+				continue;
+			}
+			const int32* OwnerIndex = ActorSlotIndices.Find(GravitySource->GetOwner());
+			SourcePositions.Add(GravitySource->GetComponentLocation());
+			SourceMasses.Add(GravitySource->Mass);
+			SourceKeys.Add(OwnerIndex ? *OwnerIndex : INDEX_NONE);
+		}
+	}
+	SourceTree.Build(SourcePositions, SourceMasses, SourceKeys);
+}
+
+// --- Object Overlap Notification ---
+void UGravityManager::NotifyObjectEnteredZone(AActor* AffectedActor, AGravityZone* GravityZone)
+{
+	if (AffectedActor && GravityZone && CanBeAffected(AffectedActor))
+	{
+		const int32 ZoneIndex = FindOrAddZoneSlot(GravityZone);
+		if (IsActorExcluded(GetActorTagMask(AffectedActor), ZoneIndex)) return;
+
+		const int32 ActorIndex = FindOrAddActorSlot(AffectedActor);
+		if (!ActorSlots[ActorIndex].bQueryByPosition)
+		{
+			AddOverlap(ActorIndex, ZoneIndex);
+		}
+	}
+}
+
+void UGravityManager::NotifyObjectLeftZone(AActor* AffectedActor, AGravityZone* GravityZone)
+{
+	if (AffectedActor && GravityZone)
+	{
+		const int32* ActorIndex = ActorSlotIndices.Find(AffectedActor);
+		const int32 ZoneIndex = FindZoneSlot(GravityZone);
+		if (ActorIndex && ZoneIndex != INDEX_NONE && !ActorSlots[*ActorIndex].bQueryByPosition)
+		{
+			RemoveOverlap(*ActorIndex, ZoneIndex);
+		}
+	}
+}
+
+// --- Position Query Membership ---
+void UGravityManager::RegisterPositionQueryActor(AActor* AffectedActor)
+{
+	if (AffectedActor && CanBeAffected(AffectedActor))
+	{
+		ActorSlots[FindOrAddActorSlot(AffectedActor)].bQueryByPosition = true;
+	}
+}
+
+void UGravityManager::UnregisterPositionQueryActor(AActor* AffectedActor)
+{
+	if (const int32* ActorIndex = AffectedActor ? ActorSlotIndices.Find(AffectedActor) : nullptr)
+	{
+		FActorSlot& ActorSlot = ActorSlots[*ActorIndex];
+		ActorSlot.bQueryByPosition = false;
+		while (ActorSlot.Zones.Num() > 0)
+		{
+			RemoveOverlap(*ActorIndex, ActorSlot.Zones.Last());
+		}
+	}
+}
+
+// One batched octree pass over every position query actor, diffing the result against its current zones
+void UGravityManager::ResolvePositionQueries()
+{
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
+	{
+		FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		if (!ActorSlot.bQueryByPosition) continue;
+
+		const FVector Location = ActorSlot.Actor->GetActorLocation();
+		QueryZones.Reset();
+		ZoneOctree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Location, FVector::ZeroVector), [this, &Location](const FGravityZoneOctreeElement& Element)
+		{
+			for (const FGravityZoneVolume& Volume : ZoneSlots[Element.ZoneIndex].Volumes)
+			{
+				if (Volume.Contains(Location))
+				{
+					QueryZones.Add(Element.ZoneIndex);
+					return;
+				}
+			}
+		});
+
+		for (int32 Index = ActorSlot.Zones.Num() - 1; Index >= 0; --Index)
+		{
+			if (!QueryZones.Contains(ActorSlot.Zones[Index]))
+			{
+				RemoveOverlap(ActorIndex, ActorSlot.Zones[Index]);
+			}
+		}
+		for (int32 ZoneIndex : QueryZones)
+		{
+			if (!ActorSlot.Zones.Contains(ZoneIndex) && !IsActorExcluded(ActorSlot.TagMask, ZoneIndex))
+			{
+				AddOverlap(ActorIndex, ZoneIndex);
+			}
+		}
+	}
+}
+
+// --- Zone Volumes ---
+void FGravityZoneOctreeSemantics::SetElementId(const FGravityZoneOctreeElement& Element, FOctreeElementId2 Id)
+{
+	Element.Zone->OctreeId = Id;
+}
+
+// Watches the root and every shape GetZoneVolumes reads, a shape can move on its own without the root moving
+void UGravityManager::BindZoneTransforms(FZoneSlot& ZoneSlot)
+{
+	TInlineComponentArray<USceneComponent*> SceneComponents(ZoneSlot.Zone);
+	for (USceneComponent* SceneComp : SceneComponents)
+	{
+		const UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(SceneComp);
+		if (SceneComp == ZoneSlot.Zone->GetRootComponent() || (PrimComp && PrimComp->GetGenerateOverlapEvents()))
+		{
+			const FDelegateHandle Handle = SceneComp->TransformUpdated.AddUObject(this, &UGravityManager::OnZoneTransformUpdated);
+			ZoneSlot.TransformBindings.Emplace(SceneComp, Handle);
+		}
+	}
+}
+
+void UGravityManager::UnbindZoneTransforms(FZoneSlot& ZoneSlot)
+{
+	for (const TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>& Binding : ZoneSlot.TransformBindings)
+	{
+		if (USceneComponent* SceneComp = Binding.Key.Get())
+		{
+			SceneComp->TransformUpdated.Remove(Binding.Value);
+		}
+	}
+	ZoneSlot.TransformBindings.Reset();
+}
+
+void UGravityManager::MarkZoneVolumesDirty(AGravityZone* GravityZone)
+{
+	const int32 ZoneIndex = GravityZone ? FindZoneSlot(GravityZone) : INDEX_NONE;
+	if (ZoneIndex == INDEX_NONE) return;
+
+	//Rebinding picks up shapes added or removed since the zone registered
+	FZoneSlot& ZoneSlot = ZoneSlots[ZoneIndex];
+	UnbindZoneTransforms(ZoneSlot);
+	BindZoneTransforms(ZoneSlot);
+	ZoneSlot.bVolumesDirty = true;
+}
+
+void UGravityManager::OnZoneTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (const AGravityZone* GravityZone = Cast<AGravityZone>(UpdatedComponent->GetOwner()))
+	{
+		const int32 ZoneIndex = FindZoneSlot(GravityZone);
+		if (ZoneIndex != INDEX_NONE)
+		{
+			ZoneSlots[ZoneIndex].bVolumesDirty = true;
+		}
+	}
+}
+
+// Re-inserts only the zones that moved or were marked dirty since the last tick
+void UGravityManager::UpdateZoneVolumes()
+{
+	for (int32 ZoneIndex = 0; ZoneIndex < ZoneSlots.Num(); ++ZoneIndex)
+	{
+		FZoneSlot& ZoneSlot = ZoneSlots[ZoneIndex];
+		if (!ZoneSlot.Zone || !ZoneSlot.bVolumesDirty) continue;
+		ZoneSlot.bVolumesDirty = false;
+
+		if (ZoneSlot.Zone->OctreeId.IsValidId())
+		{
+			ZoneOctree.RemoveElement(ZoneSlot.Zone->OctreeId);
+			ZoneSlot.Zone->OctreeId = FOctreeElementId2();
+		}
+
+		ZoneSlot.Zone->GetZoneVolumes(ZoneSlot.Volumes);
+		FBox Bounds(ForceInit);
+		for (const FGravityZoneVolume& Volume : ZoneSlot.Volumes)
+		{
+			Bounds += Volume.GetBounds();
+		}
+		if (Bounds.IsValid)
+		{
+			ZoneOctree.AddElement({ ZoneSlot.Zone, ZoneIndex, FBoxCenterAndExtent(Bounds) });
+		}
+	}
+}
+
+// --- Zone Onboarding ---
+// Adds the overlaps of the batch in flight within the tick budget, then starts the next batch once it is drained
+void UGravityManager::OnboardPendingZones()
+{
+	if (!ZoneOnboarding.IsValid() && PendingZones.Num() == 0) return;
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityZoneOnboarding);
+
+	if (ZoneOnboarding.IsValid())
+	{
+		if (!ZoneOnboardingTask.IsCompleted()) return;
+
+		//Zones unregistered and actors destroyed since the batch started are skipped
+		FZoneOnboarding& Onboarding = *ZoneOnboarding;
+		const double EndTime = FPlatformTime::Seconds() + ZoneOnboardingBudgetMs * 0.001;
+		int32 LastCandidate = INDEX_NONE;
+		AActor* AffectedActor = nullptr;
+		uint64 TagMask = 0;
+		int32 ActorIndex = INDEX_NONE;
+		for (; Onboarding.NextOverlap < Onboarding.Overlaps.Num(); ++Onboarding.NextOverlap)
+		{
+			if ((Onboarding.NextOverlap & 31) == 0 && FPlatformTime::Seconds() > EndTime) break;
+
+			const TPair<int32, int32>& Overlap = Onboarding.Overlaps[Onboarding.NextOverlap];
+			if (Overlap.Key != LastCandidate)
+			{
+				LastCandidate = Overlap.Key;
+				AffectedActor = Onboarding.Candidates[Overlap.Key].Actor.Get();
+				if (AffectedActor && !CanBeAffected(AffectedActor))
+				{
+					AffectedActor = nullptr;
+				}
+				TagMask = AffectedActor ? GetActorTagMask(AffectedActor) : 0;
+				ActorIndex = INDEX_NONE;
+			}
+			if (!AffectedActor) continue;
+
+			//The actor only gets a slot once a zone actually takes it
+			const FGravityZoneHandle& Handle = Onboarding.Zones[Overlap.Value].Handle;
+			const FZoneSlot& ZoneSlot = ZoneSlots[Handle.Index];
+			if (!ZoneSlot.Zone || ZoneSlot.Generation != Handle.Generation || IsActorExcluded(TagMask, Handle.Index)) continue;
+			if (ActorIndex == INDEX_NONE)
+			{
+				ActorIndex = FindOrAddActorSlot(AffectedActor);
+			}
+			if (!ActorSlots[ActorIndex].bQueryByPosition)
+			{
+				AddOverlap(ActorIndex, Handle.Index);
+			}
+		}
+		if (Onboarding.NextOverlap < Onboarding.Overlaps.Num()) return;
+		ZoneOnboarding.Reset();
+	}
+
+	if (PendingZones.Num() > 0)
+	{
+		StartZoneOnboarding();
+	}
+}
+
+// One broadphase query around a batch of new zones on the game thread, then the per body shape and
+// collision response tests run as a task against plain copies of both sides
+void UGravityManager::StartZoneOnboarding()
+{
+	TSharedPtr<FZoneOnboarding, ESPMode::ThreadSafe> Onboarding = MakeShared<FZoneOnboarding, ESPMode::ThreadSafe>();
+	const int32 NumPending = FMath::Min(PendingZones.Num(), FMath::Max(ZoneOnboardingBatchSize, 1));
+	FBox BatchBounds(ForceInit);
+	for (int32 PendingIndex = 0; PendingIndex < NumPending; ++PendingIndex)
+	{
+		const FGravityZoneHandle& Handle = PendingZones[PendingIndex];
+		const FZoneSlot& ZoneSlot = ZoneSlots[Handle.Index];
+		if (!ZoneSlot.Zone || ZoneSlot.Generation != Handle.Generation) continue;
+
+		FOnboardingZone& Zone = Onboarding->Zones.AddDefaulted_GetRef();
+		Zone.Handle = Handle;
+		Zone.Volumes = ZoneSlot.Volumes;
+		for (const FGravityZoneVolume& Volume : Zone.Volumes)
+		{
+			Zone.Bounds += Volume.GetBounds();
+		}
+		TInlineComponentArray<UPrimitiveComponent*> PrimitiveComponents(ZoneSlot.Zone);
+		for (const UPrimitiveComponent* PrimComp : PrimitiveComponents)
+		{
+			if (PrimComp && PrimComp->GetGenerateOverlapEvents())
+			{
+				Zone.ObjectType = PrimComp->GetCollisionObjectType();
+				Zone.Responses = PrimComp->GetCollisionResponseToChannels();
+				break;
+			}
+		}
+		BatchBounds += Zone.Bounds;
+	}
+	PendingZones.RemoveAt(0, NumPending, EAllowShrinking::No);
+
+	UWorld* World = GetWorld();
+	if (!World || !BatchBounds.IsValid) return;
+
+	TArray<FOverlapResult> OverlapResults;
+	World->OverlapMultiByObjectType(OverlapResults, BatchBounds.GetCenter(), FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects),
+		FCollisionShape::MakeBox(BatchBounds.GetExtent()), FCollisionQueryParams(SCENE_QUERY_STAT(GravityZoneOnboarding), false));
+	for (const FOverlapResult& OverlapResult : OverlapResults)
+	{
+		const UPrimitiveComponent* PrimComp = OverlapResult.GetComponent();
+		AActor* CandidateActor = OverlapResult.GetActor();
+		if (!PrimComp || !CandidateActor || !PrimComp->GetGenerateOverlapEvents() || Cast<AGravityZone>(CandidateActor)) continue;
+
+		FOnboardingCandidate& Candidate = Onboarding->Candidates.AddDefaulted_GetRef();
+		Candidate.Actor = CandidateActor;
+		Candidate.Center = PrimComp->Bounds.Origin;
+		Candidate.Radius = PrimComp->Bounds.SphereRadius;
+		Candidate.ObjectType = PrimComp->GetCollisionObjectType();
+		Candidate.Responses = PrimComp->GetCollisionResponseToChannels();
+	}
+
+	ZoneOnboarding = Onboarding;
+	ZoneOnboardingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Onboarding]()
+	{
+		GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityZoneOnboarding);
+		FZoneOnboarding& Batch = *Onboarding;
+		for (int32 CandidateIndex = 0; CandidateIndex < Batch.Candidates.Num(); ++CandidateIndex)
+		{
+			const FOnboardingCandidate& Candidate = Batch.Candidates[CandidateIndex];
+			for (int32 ZoneIndex = 0; ZoneIndex < Batch.Zones.Num(); ++ZoneIndex)
+			{
+				//Overlap events need both sides to at least overlap the other's object type
+				const FOnboardingZone& Zone = Batch.Zones[ZoneIndex];
+				if (Zone.Bounds.ComputeSquaredDistanceToPoint(Candidate.Center) > FMath::Square(Candidate.Radius)) continue;
+				if (Zone.Responses.GetResponse(Candidate.ObjectType) == ECR_Ignore || Candidate.Responses.GetResponse(Zone.ObjectType) == ECR_Ignore) continue;
+				for (const FGravityZoneVolume& Volume : Zone.Volumes)
+				{
+					if (Volume.IntersectsSphere(Candidate.Center, Candidate.Radius))
+					{
+						Batch.Overlaps.Emplace(CandidateIndex, ZoneIndex);
+						break;
+					}
+				}
+			}
+		}
+	});
+}
+
+// --- Registry Helpers ---
+bool UGravityManager::CanBeAffected(AActor* AffectedActor) const
+{
+	return Cast<ACharacter>(AffectedActor) || AffectedActor->FindComponentByClass<UPrimitiveComponent>();
+}
+
+// --- Exclusion Masks ---
+uint64 UGravityManager::ResolveExclusionMask(TConstArrayView<FName> ExclusionTags)
+{
+	uint64 Mask = 0;
+	bool bNewBits = false;
+	for (const FName Tag : ExclusionTags)
+	{
+		if (Tag.IsNone()) continue;
+		const int32* Bit = ExclusionTagBits.Find(Tag);
+		if (!Bit)
+		{
+			if (ExclusionTagBits.Num() == 64)
+			{
+				UE_LOG(LogGravity, Warning, TEXT("More than 64 distinct gravity exclusion tags, tags from %s on share one bit and may exclude each other's actors"), *Tag.ToString());
+			}
+			Bit = &ExclusionTagBits.Add(Tag, FMath::Min(ExclusionTagBits.Num(), 63));
+			bNewBits = true;
+		}
+		Mask |= uint64(1) << *Bit;
+	}
+
+	//Actor masks only hold the tags some zone excludes, so tracked actors have to pick up a newly added one
+	if (bNewBits)
+	{
+		for (FActorSlot& ActorSlot : ActorSlots)
+		{
+			ActorSlot.TagMask = ResolveTagMask(ActorSlot.Actor);
+		}
+	}
+	return Mask;
+}
+
+uint64 UGravityManager::ResolveTagMask(const AActor* AffectedActor) const
+{
+	uint64 Mask = 0;
+	if (ExclusionTagBits.Num() > 0 && AffectedActor)
+	{
+		for (const FName Tag : AffectedActor->Tags)
+		{
+			if (const int32* Bit = ExclusionTagBits.Find(Tag))
+			{
+				Mask |= uint64(1) << *Bit;
+			}
+		}
+	}
+	return Mask;
+}
+
+// Tracked actors use the mask resolved when they were added, others are resolved from their tags by name
+uint64 UGravityManager::GetActorTagMask(const AActor* AffectedActor) const
+{
+	if (const int32* ActorIndex = ActorSlotIndices.Find(AffectedActor))
+	{
+		return ActorSlots[*ActorIndex].TagMask;
+	}
+	return ResolveTagMask(AffectedActor);
+}
+
+void UGravityManager::NotifyZoneExclusionTagsChanged(AGravityZone* GravityZone, TConstArrayView<FName> ExclusionTags)
+{
+	const int32 ZoneIndex = GravityZone ? FindZoneSlot(GravityZone) : INDEX_NONE;
+	if (ZoneIndex == INDEX_NONE) return;
+
+	const uint64 OldMask = ZoneSlots[ZoneIndex].ExclusionMask;
+	const uint64 NewMask = ResolveExclusionMask(ExclusionTags);
+	ZoneSlots[ZoneIndex].ExclusionMask = NewMask;
+
+	//Walking backwards keeps the actor swapped in by RemoveOverlap out of the part still to be visited
+	const TArray<int32>& ZoneActors = ZoneSlots[ZoneIndex].Actors;
+	for (int32 Index = ZoneActors.Num() - 1; Index >= 0; --Index)
+	{
+		const int32 ActorIndex = ZoneActors[Index];
+		if (IsActorExcluded(ActorSlots[ActorIndex].TagMask, ZoneIndex))
+		{
+			RemoveOverlap(ActorIndex, ZoneIndex);
+		}
+	}
+
+	//Actors the old mask turned away never got an overlap, so ask the zone for them again
+	if ((OldMask & ~NewMask) != 0)
+	{
+		TArray<AActor*> OverlappingActors;
+		GravityZone->GetOverlappingActors(OverlappingActors);
+		for (AActor* OverlappingActor : OverlappingActors)
+		{
+			NotifyObjectEnteredZone(OverlappingActor, GravityZone);
+		}
+	}
+}
+
+void UGravityManager::NotifyActorTagsChanged(AActor* AffectedActor)
+{
+	if (!AffectedActor) return;
+
+	const uint64 NewMask = ResolveTagMask(AffectedActor);
+	bool bMaskRelaxed = true;
+	if (const int32* ActorIndex = ActorSlotIndices.Find(AffectedActor))
+	{
+		FActorSlot& ActorSlot = ActorSlots[*ActorIndex];
+		bMaskRelaxed = (ActorSlot.TagMask & ~NewMask) != 0;
+		ActorSlot.TagMask = NewMask;
+		for (int32 Index = ActorSlot.Zones.Num() - 1; Index >= 0; --Index)
+		{
+			if (IsActorExcluded(NewMask, ActorSlot.Zones[Index]))
+			{
+				RemoveOverlap(*ActorIndex, ActorSlot.Zones[Index]);
+			}
+		}
+	}
+
+	//Zones that turned the actor away before may take it now
+	if (bMaskRelaxed)
+	{
+		TArray<AActor*> OverlappingZones;
+		AffectedActor->GetOverlappingActors(OverlappingZones, AGravityZone::StaticClass());
+		for (AActor* OverlappingZone : OverlappingZones)
+		{
+			NotifyObjectEnteredZone(AffectedActor, CastChecked<AGravityZone>(OverlappingZone));
+		}
+	}
+}
+
+void UGravityManager::AddOverlap(int32 ActorIndex, int32 ZoneIndex)
+{
+	FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+	if (!ActorSlot.Zones.Contains(ZoneIndex))
+	{
+		ActorSlot.Zones.Add(ZoneIndex);
+		ZoneSlots[ZoneIndex].Actors.Add(ActorIndex);
+
+		//Entering only ever raises or joins the active priority, the same rule as GravKernel::ResolvePriorities without a rescan
+		const int32 ZonePriority = ZoneSlots[ZoneIndex].Priority;
+		if (ZonePriority > ActorSlot.ActivePriority)
+		{
+			ActorSlot.ActiveZones.Reset();
+			ActorSlot.ActivePriority = ZonePriority;
+		}
+		if (ZonePriority == ActorSlot.ActivePriority)
+		{
+			ActorSlot.ActiveZones.Add(ZoneIndex);
+		}
+		SyncZoneSet(ActorSlot);
+	}
+}
+
+void UGravityManager::RemoveOverlap(int32 ActorIndex, int32 ZoneIndex)
+{
+	FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+	if (ActorSlot.Zones.Remove(ZoneIndex) > 0)
+	{
+		//Actors left with no zones are dropped by ReleaseZonelessActors at the end of the tick, removing the slot here would move others under the caller
+		ZoneSlots[ZoneIndex].Actors.RemoveSingleSwap(ActorIndex, EAllowShrinking::No);
+		if (ActorSlot.ActiveZones.Remove(ZoneIndex) > 0 && ActorSlot.ActiveZones.Num() == 0)
+		{
+			ResolveActiveZones(ActorSlot);
+		}
+		if (ActorSlot.Zones.Num() == 0)
+		{
+			RestoreActorDamping(ActorSlot);
+		}
+		SyncZoneSet(ActorSlot);
+	}
+}
+
+// The actor is a single entity whose lanes are its zones, resolved by the kernel rule the field snapshot uses
+void UGravityManager::ResolveActiveZones(FActorSlot& ActorSlot)
+{
+	const int32 NumZones = ActorSlot.Zones.Num();
+	TArray<int32, TInlineAllocator<8>> LaneEntities;
+	TArray<double, TInlineAllocator<8>> LanePriorities;
+	LaneEntities.SetNumZeroed(NumZones);
+	for (int32 ZoneIndex : ActorSlot.Zones)
+	{
+		LanePriorities.Add(ZoneSlots[ZoneIndex].Priority);
+	}
+	double ActivePriority = GravKernel::LowestPriority;
+	GravKernel::ResolvePriorities(LaneEntities.GetData(), LanePriorities.GetData(), &ActivePriority, NumZones);
+
+	ActorSlot.ActivePriority = int32(ActivePriority);
+	ActorSlot.ActiveZones.Reset();
+	for (int32 ZoneIndex : ActorSlot.Zones)
+	{
+		if (ZoneSlots[ZoneIndex].Priority == ActorSlot.ActivePriority)
+		{
+			ActorSlot.ActiveZones.Add(ZoneIndex);
+		}
+	}
+	SyncZoneSet(ActorSlot);
+}
+
+// Copies the active zones into the set a gravity movement component samples from
+void UGravityManager::SyncZoneSet(const FActorSlot& ActorSlot)
+{
+	FGravityZoneSet* ZoneSet = ActorSlot.ZoneSet.Get();
+	if (!ZoneSet) return;
+	ZoneSet->Zones.Reset();
+	for (int32 ZoneIndex : ActorSlot.ActiveZones)
+	{
+		ZoneSet->Zones.Add(ZoneSlots[ZoneIndex].Zone);
+	}
+	ZoneSet->Priority = ActorSlot.ActivePriority;
+	ZoneSet->bTracked = true;
+	ZoneSet->bIgnoreGravitySources = ActorSlot.bIgnoreGravitySources;
+	ZoneSet->bReplicatedGravity = ActorSlot.bReplicatedGravity;
+	ZoneSet->ReplicatedGravity = ActorSlot.ReplicatedGravity;
+}
+
+void UGravityManager::NotifyZonePriorityChanged(AGravityZone* GravityZone)
+{
+	const int32 ZoneIndex = GravityZone ? FindZoneSlot(GravityZone) : INDEX_NONE;
+	if (ZoneIndex != INDEX_NONE && ZoneSlots[ZoneIndex].Priority != GravityZone->Priority)
+	{
+		OnZonePriorityChanged(ZoneIndex);
+	}
+}
+
+// Only the actors inside the zone are re-resolved
+void UGravityManager::OnZonePriorityChanged(int32 ZoneIndex)
+{
+	FZoneSlot& ZoneSlot = ZoneSlots[ZoneIndex];
+	ZoneSlot.Priority = ZoneSlot.Zone->Priority;
+	for (int32 ActorIndex : ZoneSlot.Actors)
+	{
+		ResolveActiveZones(ActorSlots[ActorIndex]);
+	}
+}
+
+int32 UGravityManager::FindZoneSlot(const AGravityZone* GravityZone) const
+{
+	const FGravityZoneHandle& Handle = GravityZone->ManagerHandle;
+	if (ZoneSlots.IsValidIndex(Handle.Index) && ZoneSlots[Handle.Index].Generation == Handle.Generation && ZoneSlots[Handle.Index].Zone == GravityZone)
+	{
+		return Handle.Index;
+	}
+	return INDEX_NONE;
+}
+
+int32 UGravityManager::FindOrAddZoneSlot(AGravityZone* GravityZone)
+{
+	const int32 ExistingIndex = FindZoneSlot(GravityZone);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	const int32 ZoneIndex = FreeZoneSlots.Num() > 0 ? FreeZoneSlots.Pop(EAllowShrinking::No) : ZoneSlots.AddDefaulted();
+	FZoneSlot& ZoneSlot = ZoneSlots[ZoneIndex];
+	ZoneSlot.Zone = GravityZone;
+	ZoneSlot.Priority = GravityZone->Priority;
+	ZoneSlot.bVolumesDirty = true;
+
+	//Tag strings are converted once here, exclusion checks afterwards only compare masks
+	TArray<FName, TInlineAllocator<4>> ExclusionTags;
+	for (const FString& ExclusionTag : GravityZone->ExclusionTags)
+	{
+		ExclusionTags.Add(FName(*ExclusionTag));
+	}
+	ZoneSlot.ExclusionMask = ResolveExclusionMask(ExclusionTags);
+	BindZoneTransforms(ZoneSlot);
+	GravityZone->ManagerHandle.Index = ZoneIndex;
+	GravityZone->ManagerHandle.Generation = ZoneSlot.Generation;
+	return ZoneIndex;
+}
+
+// Cost is proportional to the overlaps of this zone, not to the number of tracked actors
+void UGravityManager::ReleaseZoneSlot(int32 ZoneIndex)
+{
+	FZoneSlot& ZoneSlot = ZoneSlots[ZoneIndex];
+	TArray<int32> OverlappingActors = MoveTemp(ZoneSlot.Actors);
+	ZoneSlot.Actors.Reset();
+	UnbindZoneTransforms(ZoneSlot);
+	if (ZoneSlot.Zone->OctreeId.IsValidId())
+	{
+		ZoneOctree.RemoveElement(ZoneSlot.Zone->OctreeId);
+		ZoneSlot.Zone->OctreeId = FOctreeElementId2();
+	}
+	ZoneSlot.Volumes.Reset();
+	ZoneSlot.Zone->ManagerHandle.Reset();
+	ZoneSlot.Zone = nullptr;
+	ZoneSlot.Generation++;
+	FreeZoneSlots.Add(ZoneIndex);
+
+	//Actors left without zones keep their slot until ReleaseZonelessActors, like actors leaving a zone
+	for (int32 ActorIndex : OverlappingActors)
+	{
+		FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		ActorSlot.Zones.Remove(ZoneIndex);
+		if (ActorSlot.ActiveZones.Remove(ZoneIndex) > 0)
+		{
+			if (ActorSlot.ActiveZones.Num() == 0)
+			{
+				ResolveActiveZones(ActorSlot);
+			}
+			SyncZoneSet(ActorSlot);
+		}
+		if (ActorSlot.Zones.Num() == 0)
+		{
+			RestoreActorDamping(ActorSlot);
+		}
+	}
+}
+
+int32 UGravityManager::FindOrAddActorSlot(AActor* AffectedActor)
+{
+	if (const int32* ExistingIndex = ActorSlotIndices.Find(AffectedActor))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 ActorIndex = ActorSlots.AddDefaulted();
+	ActorSlots[ActorIndex].Actor = AffectedActor;
+	ActorSlots[ActorIndex].bSignificant = SignificantActors.Contains(AffectedActor);
+	ActorSlots[ActorIndex].TagMask = ResolveTagMask(AffectedActor);
+	ActorSlotIndices.Add(AffectedActor, ActorIndex);
+
+	//Gravity movement components hand over their zone set once, after which membership changes keep it current
+	const ACharacter* Character = Cast<ACharacter>(AffectedActor);
+	if (UGravityMovementComponent* GravityMovement = Character ? Cast<UGravityMovementComponent>(Character->GetCharacterMovement()) : nullptr)
+	{
+		ActorSlots[ActorIndex].ZoneSet = GravityMovement->GetZoneSet();
+		SyncZoneSet(ActorSlots[ActorIndex]);
+	}
+	return ActorIndex;
+}
+
+void UGravityManager::RemoveActorSlot(int32 ActorIndex)
+{
+	FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+	for (int32 ZoneIndex : ActorSlot.Zones)
+	{
+		ZoneSlots[ZoneIndex].Actors.RemoveSingleSwap(ActorIndex, EAllowShrinking::No);
+	}
+	ActorSlotIndices.Remove(ActorSlot.Actor);
+	ReleaseGravityGroup(ActorSlot, !ActorSlot.bTargetsDirty && IsValid(ActorSlot.Actor)); //Cached bodies may no longer exist
+	if (ActorSlot.ZoneSet)
+	{
+		ActorSlot.ZoneSet->Reset();
+	}
+	if (AGravityReplicationProxy* Proxy = ReplicationProxy.Get(); Proxy && Proxy->HasAuthority())
+	{
+		Proxy->RemoveActor(ActorSlot.Actor);
+	}
+
+	//Move the last slot into the hole and repoint the zones that reference it
+	const int32 LastIndex = ActorSlots.Num() - 1;
+	if (ActorIndex != LastIndex)
+	{
+		for (int32 ZoneIndex : ActorSlots[LastIndex].Zones)
+		{
+			TArray<int32>& ZoneActors = ZoneSlots[ZoneIndex].Actors;
+			ZoneActors[ZoneActors.Find(LastIndex)] = ActorIndex;
+		}
+		ActorSlotIndices.Add(ActorSlots[LastIndex].Actor, ActorIndex);
+	}
+	ActorSlots.RemoveAtSwap(ActorIndex, 1, EAllowShrinking::No);
+}
+
+// Position query actors, source owners and replicated actors are tracked for reasons other than overlaps
+bool UGravityManager::CanReleaseActorSlot(const FActorSlot& ActorSlot) const
+{
+	return ActorSlot.Zones.Num() == 0 && !ActorSlot.bQueryByPosition && !ActorSlot.bOwnsGravitySource && !ActorSlot.bReplicatedGravity;
+}
+
+// Drops actors that left every zone. Runs after apply, so a character processed this tick was already handed the
+// zero gravity it gets outside zones. Characters still waiting for their tier's turn stay until they have been
+// given it.
+void UGravityManager::ReleaseZonelessActors()
+{
+	//Walking backwards keeps the slot swapped into a hole out of the part still to be visited
+	for (int32 ActorIndex = ActorSlots.Num() - 1; ActorIndex >= 0; --ActorIndex)
+	{
+		const FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		//Characters with a zone set sample their own gravity, so they never wait on the manager
+		const bool bAwaitingGravity = ActorSlot.MovementComp && !ActorSlot.ZoneSet && ActorSnapshots[ActorIndex].bSkip;
+		if (CanReleaseActorSlot(ActorSlot) && !bAwaitingGravity)
+		{
+			RemoveActorSlot(ActorIndex);
+			ActorSnapshots.RemoveAtSwap(ActorIndex, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+// --- Tick Function ---
+void UGravityManager::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GravityManager_Tick, GravityChannel);
+	TickStats = FGravityTickStats();
+
+	GatherTickData(DeltaTime);
+	ResolveZonePriorities();
+	ComputeTickData();
+	PublishReplicatedGravity();
+	UpdateGravityGroups();
+	UpdateSimCallback();
+	ApplyTickData();
+	ReleaseZonelessActors();
+
+	SET_DWORD_STAT(STAT_GravityActorsProcessed, TickStats.ActorsProcessed);
+	SET_DWORD_STAT(STAT_GravityZoneEvaluations, TickStats.ZoneEvaluations);
+	SET_DWORD_STAT(STAT_GravityBlueprintEvaluations, TickStats.BlueprintEvaluations);
+	SET_DWORD_STAT(STAT_GravityBodiesTouched, TickStats.BodiesTouched);
+	SET_DWORD_STAT(STAT_GravityActorsFull, TierCounts.Full);
+	SET_DWORD_STAT(STAT_GravityActorsReduced, TierCounts.Reduced);
+	SET_DWORD_STAT(STAT_GravityActorsAsleep, TierCounts.Asleep);
+	SET_DWORD_STAT(STAT_GravityActorsGrouped, TickStats.ActorsInGravityGroups);
+}
+
+TStatId UGravityManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGravityManager, STATGROUP_Gravity);
+}
+
+// --- Tick Phases ---
+// Gather: game thread only, snapshots actor and zone state and assigns update tiers
+void UGravityManager::GatherTickData(float DeltaTime)
+{
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityGather);
+
+	//Drop actors destroyed since the last tick, walking backwards so swapped in slots were already checked
+	for (int32 ActorIndex = ActorSlots.Num() - 1; ActorIndex >= 0; --ActorIndex)
+	{
+		if (!IsValid(ActorSlots[ActorIndex].Actor))
+		{
+			RemoveActorSlot(ActorIndex);
+		}
+	}
+
+	UpdateZoneVolumes();
+	OnboardPendingZones();
+	ResolvePositionQueries();
+	BuildSourceTree();
+
+	ZoneSnapshots.SetNum(ZoneSlots.Num(), EAllowShrinking::No);
+	for (int32 ZoneIndex = 0; ZoneIndex < ZoneSlots.Num(); ++ZoneIndex)
+	{
+		FZoneSnapshot& ZoneSnapshot = ZoneSnapshots[ZoneIndex];
+		AGravityZone* GravityZone = ZoneSlots[ZoneIndex].Zone;
+		ZoneSnapshot.Zone = GravityZone;
+		if (!GravityZone) continue;
+		if (ZoneSlots[ZoneIndex].Priority != GravityZone->Priority)
+		{
+			//Catches native code writing Priority directly rather than through SetPriority
+			OnZonePriorityChanged(ZoneIndex);
+		}
+		ZoneSnapshot.Priority = ZoneSlots[ZoneIndex].Priority;
+		ZoneSnapshot.Field = GravityZone->GetFieldParams();
+		ZoneSnapshot.LinearDamping = GravityZone->LinearDamping;
+		ZoneSnapshot.AngularDamping = GravityZone->AngularDamping;
+		ZoneSnapshot.bCustomGravity = ZoneSnapshot.Field.Type == EGravityFieldType::Custom;
+		ZoneSnapshot.bCustomDampening = GravityZone->HasCustomDampening();
+	}
+
+	PublishFieldSnapshot();
+
+	GravitySamples.Reset();
+	DampingSamples.Reset();
+	ActorSnapshots.Reset();
+
+	PlayerViewLocations.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (APlayerController* PlayerController = It->Get())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+				PlayerViewLocations.Add(ViewLocation);
+			}
+		}
+	}
+	TierCounts = FGravityTierCounts();
+	TickCounter++;
+
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
+	{
+		FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		if (ActorSlot.bTargetsDirty)
+		{
+			RefreshActorTargets(ActorSlot);
+		}
+
+		AActor* AffectedActor = ActorSlot.Actor;
+		FActorSnapshot& Snapshot = ActorSnapshots.AddDefaulted_GetRef();
+		Snapshot.Actor = AffectedActor;
+		Snapshot.Location = AffectedActor->GetActorLocation();
+
+		//Gravity movement components sample their zone set themselves, the manager only drives their ragdoll bodies
+		if (ActorSlot.ZoneSet && !(ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics()))
+		{
+			ActorSlot.AccumulatedTime = 0.f;
+			Snapshot.bSkip = true;
+			continue;
+		}
+
+		//Tiering decides whether the actor is processed at all this tick
+		ActorSlot.AccumulatedTime += DeltaTime;
+		switch (ResolveUpdateTier(ActorSlot, Snapshot.Location))
+		{
+		case EGravityUpdateTier::Asleep:
+			TierCounts.Asleep++;
+			ActorSlot.AccumulatedTime = 0.f;
+			Snapshot.bSkip = true;
+			break;
+		case EGravityUpdateTier::Reduced:
+			TierCounts.Reduced++;
+			Snapshot.bSkip = (TickCounter + ActorIndex) % TierPolicy.ReducedRateInterval != 0;
+			break;
+		default:
+			TierCounts.Full++;
+			break;
+		}
+		if (Snapshot.bSkip) continue;
+		Snapshot.GravityTimeScale = DeltaTime > 0.f ? ActorSlot.AccumulatedTime / DeltaTime : 1.f;
+		ActorSlot.AccumulatedTime = 0.f;
+
+		if (ActorSlot.MovementComp)
+		{
+			Snapshot.bIsCharacterGrounded = !ActorSlot.MovementComp->IsFalling();
+		}
+		TickStats.ActorsProcessed++;
+	}
+}
+
+// Picks the zones each actor takes gravity from and samples any Blueprint implemented zones, still game thread only
+void UGravityManager::ResolveZonePriorities()
 {
-	if (UWorld* World = Cast<UWorld>(Outer))
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityPriorityResolution);
+	const bool bNBodyActive = UseGravity && UseNBody && !SourceTree.IsEmpty();
+
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
 	{
-		return World->IsGameWorld();
+		const FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		FActorSnapshot& Snapshot = ActorSnapshots[ActorIndex];
+		if (Snapshot.bSkip) continue;
+
+		//The active zones are maintained on enter, leave and priority changes, only sources can outrank them here
+		int32 HighestPriority = ActorSlot.ActivePriority;
+		if (ActorSlot.bReplicatedGravity)
+		{
+			//The server already resolved this actor, leave no gravity samples so nothing is evaluated locally
+			Snapshot.bReplicatedGravity = true;
+			Snapshot.NetGravity = ActorSlot.ReplicatedGravity;
+			HighestPriority = INT_MAX;
+		}
+		else if (bNBodyActive && !ActorSlot.bIgnoreGravitySources)
+		{
+			HighestPriority = FMath::Max(HighestPriority, NBodyPriority);
+			Snapshot.bSampleNBody = HighestPriority == NBodyPriority;
+		}
+		Snapshot.HighestPriority = HighestPriority;
+
+		Snapshot.FirstGravitySample = GravitySamples.Num();
+		Snapshot.FirstDampingSample = DampingSamples.Num();
+		if (UseGravity && HighestPriority == ActorSlot.ActivePriority && !ActorSlot.bReplicatedGravity)
+		{
+			for (int32 ZoneIndex : ActorSlot.ActiveZones)
+			{
+				FZoneSample& Sample = GravitySamples.AddDefaulted_GetRef();
+				Sample.ZoneIndex = ZoneIndex;
+				if (ZoneSnapshots[ZoneIndex].bCustomGravity)
+				{
+					Sample.Gravity = ZoneSnapshots[ZoneIndex].Zone->GetGravityVector(Snapshot.Location);
+					TickStats.BlueprintEvaluations++;
+				}
+			}
+		}
+		if (UseDampen)
+		{
+			for (int32 ZoneIndex : ActorSlot.Zones)
+			{
+				FZoneSample& Sample = DampingSamples.AddDefaulted_GetRef();
+				Sample.ZoneIndex = ZoneIndex;
+				if (ZoneSnapshots[ZoneIndex].bCustomDampening)
+				{
+					AGravityZone* Zone = ZoneSnapshots[ZoneIndex].Zone;
+					Sample.LinearDamping = Zone->GetLinearDampening(Snapshot.Location);
+					Sample.AngularDamping = Zone->GetAngularDampening(Snapshot.Location);
+					TickStats.BlueprintEvaluations += 2;
+				}
+			}
+		}
+		Snapshot.NumGravitySamples = GravitySamples.Num() - Snapshot.FirstGravitySample;
+		Snapshot.NumDampingSamples = DampingSamples.Num() - Snapshot.FirstDampingSample;
 	}
-	return false;
+	TickStats.ZoneEvaluations = GravitySamples.Num();
 }
 
-// --- Gravity Zone Management ---
-void UGravityManager::RegisterGravityZone(AGravityZone* GravityZone) // Make sure this matches your class name
+// Compute: reads only snapshot data so actors can be processed on worker threads
+void UGravityManager::ComputeTickData()
 {
-	if (GravityZone)
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityZoneEvaluation);
+
+	if (UseGravity)
 	{
-		RegisteredGravityZones.Add(GravityZone);
-		TArray<AActor*> OverlappingActors;
-		GravityZone->GetOverlappingActors(OverlappingActors);
-		for (AActor* OverlappingActor : OverlappingActors)
+		BuildZoneBatches();
+		EvaluateZoneBatches();
+	}
+
+	const EParallelForFlags Flags = UseParallelTick ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	ParallelFor(TEXT("GravityManager.Compute"), ActorSnapshots.Num(), ParallelTickMinBatchSize, [this](int32 Index)
+	{
+		FActorSnapshot& Snapshot = ActorSnapshots[Index];
+		if (Snapshot.bSkip) return;
+		if (Snapshot.bSampleNBody)
 		{
-			NotifyObjectEnteredZone(OverlappingActor, GravityZone);
+			Snapshot.NBodyGravity = SourceTree.Evaluate(Snapshot.Location, Index, NBodyTheta, NBodyGravitationalConstant, NBodySoftening);
+		}
+		if (UseGravity && !Snapshot.bReplicatedGravity)
+		{
+			Snapshot.NetGravity = CalculateNetGravityVectorForActor(Snapshot);
+		}
+		if (UseDampen)
+		{
+			Snapshot.MaxDamping = CalculateMaxDampingVectorForActor(Snapshot);
+		}
+	}, Flags);
+}
+
+// Groups every native gravity sample by zone, laying actor positions out as separate X, Y and Z arrays
+void UGravityManager::BuildZoneBatches()
+{
+	for (FZoneSnapshot& Zone : ZoneSnapshots)
+	{
+		Zone.BatchNum = 0;
+	}
+	for (const FZoneSample& Sample : GravitySamples)
+	{
+		ZoneSnapshots[Sample.ZoneIndex].BatchNum++;
+	}
+
+	int32 NumLanes = 0;
+	BatchChunks.Reset();
+	for (int32 ZoneIndex = 0; ZoneIndex < ZoneSnapshots.Num(); ++ZoneIndex)
+	{
+		FZoneSnapshot& Zone = ZoneSnapshots[ZoneIndex];
+		if (Zone.bCustomGravity)
+		{
+			Zone.BatchNum = 0;
+		}
+		Zone.BatchStart = NumLanes;
+		NumLanes += Zone.BatchNum;
+		for (int32 ChunkStart = 0; ChunkStart < Zone.BatchNum; ChunkStart += FieldKernelChunkSize)
+		{
+			BatchChunks.Add({ ZoneIndex, Zone.BatchStart + ChunkStart, FMath::Min(FieldKernelChunkSize, Zone.BatchNum - ChunkStart) });
+		}
+		Zone.BatchNum = 0; //Reused as the fill cursor below
+	}
+
+	BatchX.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchY.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchZ.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchOutX.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchOutY.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchOutZ.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+	BatchSampleIndices.SetNumUninitialized(NumLanes, EAllowShrinking::No);
+
+	for (const FActorSnapshot& Snapshot : ActorSnapshots)
+	{
+		for (int32 SampleIndex = Snapshot.FirstGravitySample; SampleIndex < Snapshot.FirstGravitySample + Snapshot.NumGravitySamples; ++SampleIndex)
+		{
+			FZoneSnapshot& Zone = ZoneSnapshots[GravitySamples[SampleIndex].ZoneIndex];
+			if (Zone.bCustomGravity) continue;
+			const int32 Lane = Zone.BatchStart + Zone.BatchNum++;
+			BatchX[Lane] = Snapshot.Location.X;
+			BatchY[Lane] = Snapshot.Location.Y;
+			BatchZ[Lane] = Snapshot.Location.Z;
+			BatchSampleIndices[Lane] = SampleIndex;
 		}
-		UE_LOG(LogTemp, Log, TEXT("Registered Gravity Zone: %s"), *GravityZone->GetName());
 	}
 }
-void UGravityManager::UnregisterGravityZone(AGravityZone* GravityZone) // Make sure this matches your class name
+
+// Runs each zone's field kernel over its batch and scatters the results back into the per actor samples
+void UGravityManager::EvaluateZoneBatches()
 {
-	if (GravityZone)
+	const EParallelForFlags Flags = UseParallelTick ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	ParallelFor(TEXT("GravityManager.FieldKernel"), BatchChunks.Num(), 1, [this](int32 ChunkIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GravityManager_FieldKernelChunk, GravityChannel);
+		const FBatchChunk& Chunk = BatchChunks[ChunkIndex];
+		const FZoneSnapshot& Zone = ZoneSnapshots[Chunk.ZoneIndex];
+		//Batches only hold the actors' active zones, already resolved by GravKernel::ResolvePriorities, so no lane is masked
+		Zone.Field.EvaluateBatch(Zone.Priority, &BatchX[Chunk.Start], &BatchY[Chunk.Start], &BatchZ[Chunk.Start], nullptr,
+			&BatchOutX[Chunk.Start], &BatchOutY[Chunk.Start], &BatchOutZ[Chunk.Start], Chunk.Num);
+
+		//Every lane maps to a distinct sample so workers never write the same element
+		for (int32 Lane = Chunk.Start; Lane < Chunk.Start + Chunk.Num; ++Lane)
+		{
+			GravitySamples[BatchSampleIndices[Lane]].Gravity = FVector(BatchOutX[Lane], BatchOutY[Lane], BatchOutZ[Lane]);
+		}
+	}, Flags);
+}
+
+// Apply: game thread, pushes the computed results to the physics bodies and movement components
+void UGravityManager::ApplyTickData()
+{
+	if (UseGravity)
 	{
-		RegisteredGravityZones.Remove(GravityZone);
-		for (auto& Pair : ActorZoneOverlaps)
+		GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityApplyGravity);
+		for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
 		{
-			Pair.Value.Remove(GravityZone);
+			if (!ActorSnapshots[ActorIndex].bSkip)
+			{
+				ApplyGravityToActor(ActorSlots[ActorIndex], ActorSnapshots[ActorIndex]);
+			}
 		}
-		ActorZoneOverlaps.Remove(nullptr);
-		for (auto It = ActorZoneOverlaps.CreateIterator(); It; ++It)
+	}
+	if (UseDampen)
+	{
+		GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityApplyDamping);
+		for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
 		{
-			if (It.Value().Num() == 0)
+			//Zoneless actors keep their restored damping
+			if (!ActorSnapshots[ActorIndex].bSkip && ActorSlots[ActorIndex].Zones.Num() > 0)
 			{
-				It.RemoveCurrent();
+				ApplyDampingToActor(ActorSlots[ActorIndex], ActorSnapshots[ActorIndex]);
 			}
 		}
-		UE_LOG(LogTemp, Log, TEXT("Unregistered Gravity Zone: %s"), *GravityZone->GetName());
 	}
 }
 
-// --- Object Overlap Notification ---
-void UGravityManager::NotifyObjectEnteredZone(AActor* AffectedActor, AGravityZone* GravityZone)
+// --- Update Tiers ---
+void UGravityManager::SetActorSignificant(AActor* AffectedActor, bool bSignificant)
+{
+	if (!AffectedActor) return;
+	if (bSignificant)
+	{
+		SignificantActors.Add(AffectedActor);
+	}
+	else
+	{
+		SignificantActors.Remove(AffectedActor);
+	}
+	if (const int32* ActorIndex = ActorSlotIndices.Find(AffectedActor))
+	{
+		ActorSlots[*ActorIndex].bSignificant = bSignificant;
+	}
+}
+
+EGravityUpdateTier UGravityManager::ResolveUpdateTier(const FActorSlot& ActorSlot, const FVector& Location) const
 {
-	if (AffectedActor && GravityZone && (Cast<ACharacter>(AffectedActor) || AffectedActor->FindComponentByClass<UPrimitiveComponent>()))
+	const bool bDrivesMovement = ActorSlot.bIsCharacter && !(ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics());
+	if (TierPolicy.bSkipSleepingBodies && !bDrivesMovement)
 	{
-		FPermissionListOwners ActorTags = AffectedActor->Tags;
-		for (FName ATag : ActorTags) {
-			if (GravityZone->ExclusionTags.Contains(ATag)) {
-				return;
+		bool bAnyAwake = false;
+		for (const FBodyTarget& Target : ActorSlot.Bodies)
+		{
+			if (Target.Body->IsInstanceSimulatingPhysics() && Target.Body->IsInstanceAwake())
+			{
+				bAnyAwake = true;
+				break;
 			}
 		}
-		ActorZoneOverlaps.FindOrAdd(AffectedActor).Add(GravityZone);
+		if (!bAnyAwake) return EGravityUpdateTier::Asleep;
+	}
+
+	if (ActorSlot.bSignificant || ActorSlot.bHasSignificantTag || (ActorSlot.Pawn && ActorSlot.Pawn->IsPlayerControlled()))
+	{
+		return EGravityUpdateTier::Full;
+	}
+	if (TierPolicy.ReducedRateDistance <= 0.f || TierPolicy.ReducedRateInterval <= 1 || SimCallback || PlayerViewLocations.Num() == 0)
+	{
+		return EGravityUpdateTier::Full;
+	}
+
+	const double ReducedRateDistanceSquared = FMath::Square(double(TierPolicy.ReducedRateDistance));
+	for (const FVector& ViewLocation : PlayerViewLocations)
+	{
+		if (FVector::DistSquared(ViewLocation, Location) <= ReducedRateDistanceSquared)
+		{
+			return EGravityUpdateTier::Full;
+		}
 	}
+	return EGravityUpdateTier::Reduced;
 }
 
-void UGravityManager::NotifyObjectLeftZone(AActor* AffectedActor, AGravityZone* GravityZone)
+// --- Physics Substep Mode ---
+void UGravityManager::UpdateSimCallback()
 {
-	if (AffectedActor && GravityZone)
+	const bool bWantsCallback = UseGravity && UsePhysicsSubstep;
+	if (bWantsCallback && !SimCallback)
 	{
-		if (TSet<AGravityZone*>* OverlappingZones = ActorZoneOverlaps.Find(AffectedActor))
+		FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+		if (PhysScene && PhysScene->GetSolver())
 		{
-			OverlappingZones->Remove(GravityZone);
+			SimCallback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FGravitySimCallback>();
 		}
 	}
+	else if (!bWantsCallback && SimCallback)
+	{
+		UnregisterSimCallback();
+	}
+
+	if (SimCallback)
+	{
+		PushSimCallbackInput();
+	}
 }
 
-// --- Tick Function ---
-void UGravityManager::Tick(float DeltaTime)
+void UGravityManager::UnregisterSimCallback()
+{
+	if (!SimCallback) return;
+	FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+	if (PhysScene && PhysScene->GetSolver())
+	{
+		PhysScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(SimCallback);
+	}
+	SimCallback = nullptr;
+}
+
+// Hands the physics thread this frame's zone fields and the bodies they act on
+void UGravityManager::PushSimCallbackInput()
 {
-	TArray<AActor*> ActorsToProcess;
-	ActorZoneOverlaps.GetKeys(ActorsToProcess);
+	FGravitySimInput* Input = SimCallback->GetProducerInputData_External();
+	Input->Reset();
+	for (const FZoneSnapshot& Zone : ZoneSnapshots)
+	{
+		Input->Zones.Add(Zone.Field);
+	}
 
-	for (AActor* AffectedActor : ActorsToProcess)
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
 	{
-		if (!AffectedActor)
+		const FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		const FActorSnapshot& Snapshot = ActorSnapshots[ActorIndex];
+		if (Snapshot.bSkip) continue;
+		const bool bRagdoll = ActorSlot.bIsCharacter && ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics();
+		if (ActorSlot.bIsCharacter && !bRagdoll) continue; //Movement components stay on the game thread
+		if (ActorSlot.GravityGroup != INDEX_NONE) continue; //Already integrated by the solver
+
+		//Every body of the actor shares the same priority resolved zones
+		const int32 FirstZone = Input->BodyZones.Num();
+		FVector ConstantGravity = FVector::ZeroVector;
+		for (int32 SampleIndex = Snapshot.FirstGravitySample; SampleIndex < Snapshot.FirstGravitySample + Snapshot.NumGravitySamples; ++SampleIndex)
 		{
-			ActorZoneOverlaps.Remove(AffectedActor);
-			continue;
+			const FZoneSample& Sample = GravitySamples[SampleIndex];
+			if (ZoneSnapshots[Sample.ZoneIndex].bCustomGravity)
+			{
+				ConstantGravity += Sample.Gravity;
+			}
+			else
+			{
+				Input->BodyZones.Add(Sample.ZoneIndex);
+			}
 		}
-		if (UseGravity) {
-			FVector NetGravityVector = CalculateNetGravityVectorForActor(AffectedActor);
-			ApplyGravityToActorComponents(AffectedActor, NetGravityVector);
+		const int32 NumZones = Input->BodyZones.Num() - FirstZone;
+		if (Snapshot.bSampleNBody)
+		{
+			ConstantGravity += Snapshot.NBodyGravity;
 		}
-		if (UseDampen) {
-			FVector MaxDampenVector = CalculateMaxDampingVectorForActor(AffectedActor);
-			ApplyDampingToActorComponents(AffectedActor, MaxDampenVector);
+
+		for (const FBodyTarget& Target : ActorSlot.Bodies)
+		{
+			FBodyInstance* Body = Target.Body;
+			if (!Body->IsInstanceSimulatingPhysics() || (!bRagdoll && Body->bEnableGravity)) continue;
+			Input->Bodies.Add({ Body->GetPhysicsActorHandle(), FirstZone, NumZones, ConstantGravity });
 		}
 	}
 }
 
-TStatId UGravityManager::GetStatId() const
+// --- Gravity Groups ---
+// Moves actors whose gravity only comes from uniform zones into the group matching it, and back onto the force path
+// once that stops being true. Runs before the sim callback input is built so no body is driven both ways
+void UGravityManager::UpdateGravityGroups()
 {
-	RETURN_QUICK_DECLARE_CYCLE_STAT(UGravityManager, STATGROUP_Tickables);
+	const bool bUseGroups = UseGravity && UseGravityGroups;
+	for (int32 ActorIndex = 0; ActorIndex < ActorSlots.Num(); ++ActorIndex)
+	{
+		FActorSlot& ActorSlot = ActorSlots[ActorIndex];
+		const FActorSnapshot& Snapshot = ActorSnapshots[ActorIndex];
+		if (!bUseGroups || Snapshot.bSkip)
+		{
+			//Skipped actors keep their group, the solver carries on integrating them
+			if (!bUseGroups && ActorSlot.GravityGroup != INDEX_NONE)
+			{
+				ReleaseGravityGroup(ActorSlot, true);
+			}
+			TickStats.ActorsInGravityGroups += ActorSlot.GravityGroup != INDEX_NONE;
+			continue;
+		}
+
+		const bool bEligible = CanUseGravityGroup(ActorSlot, Snapshot);
+		const bool bUnchanged = bEligible && ActorSlot.GravityGroup != INDEX_NONE && !ActorSlot.bGravityGroupDirty
+			&& GravityGroups[ActorSlot.GravityGroup].Gravity.Equals(Snapshot.NetGravity, GravityGroupTolerance);
+		if (!bUnchanged)
+		{
+			ReleaseGravityGroup(ActorSlot, true);
+			if (bEligible)
+			{
+				//A full pool leaves the actor on the force path, it retries every tick
+				const int32 Group = AcquireGravityGroup(Snapshot.NetGravity);
+				if (Group != INDEX_NONE)
+				{
+					AssignGravityGroup(ActorSlot, Group);
+				}
+			}
+		}
+		TickStats.ActorsInGravityGroups += ActorSlot.GravityGroup != INDEX_NONE;
+	}
 }
 
-// --- Gravity Application Logic ---
-FVector UGravityManager::CalculateNetGravityVectorForActor(AActor* AffectedActor) const
+bool UGravityManager::CanUseGravityGroup(const FActorSlot& ActorSlot, const FActorSnapshot& Snapshot) const
 {
-	FVector NetGravity = FVector::ZeroVector;
+	//Movement components take gravity through their own scale and direction
+	const bool bRagdoll = ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics();
+	if (ActorSlot.bIsCharacter && !bRagdoll) return false;
 
-	//Early termination conditions
-	if (!AffectedActor) return NetGravity;
-	const TSet<AGravityZone*>* OverlappingZones = ActorZoneOverlaps.Find(AffectedActor);
-	if (!OverlappingZones || OverlappingZones->Num() == 0)
+	//Sources, replicated values and zero gravity are left to the force path
+	if (Snapshot.bSampleNBody || Snapshot.bReplicatedGravity || Snapshot.NumGravitySamples == 0 || Snapshot.NetGravity.IsNearlyZero()) return false;
+	for (int32 SampleIndex = Snapshot.FirstGravitySample; SampleIndex < Snapshot.FirstGravitySample + Snapshot.NumGravitySamples; ++SampleIndex)
 	{
-		return NetGravity;
+		if (ZoneSnapshots[GravitySamples[SampleIndex].ZoneIndex].Field.Type != EGravityFieldType::Uniform) return false;
 	}
 
-	// Check if the actor is a Character and if they are "grounded"
-	bool bIsCharacterGrounded = false;
-	ACharacter* Character = Cast<ACharacter>(AffectedActor);
-	if (Character)
+	//Ragdoll bodies are all driven on the force path, which only matches the group when none of them also takes world gravity
+	if (bRagdoll)
 	{
-		if (UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement())
+		for (const FBodyTarget& Target : ActorSlot.Bodies)
 		{
-			bIsCharacterGrounded = !MovementComp->IsFalling();
+			if (Target.Body->bEnableGravity) return false;
 		}
 	}
+	return true;
+}
 
-	//Accumulate gravity in one pass
-	FVector ActorLocation = AffectedActor->GetActorLocation();
-	int32 HighestPriority = -INT_MAX;
-	TArray<AGravityZone*> PriorityZones;
-	for (AGravityZone* Zone : *OverlappingZones)
+int32 UGravityManager::AcquireGravityGroup(const FVector& Gravity)
+{
+	int32 FreeGroup = INDEX_NONE;
+	for (int32 Group = 1; Group < MaxGravityGroups; ++Group)
 	{
-		if (Zone) {
-			if (Zone->Priority > HighestPriority)
-			{
-				HighestPriority = Zone->Priority;
-				PriorityZones.Empty();
-				PriorityZones.Add(Zone);
-			}
-			else if (Zone->Priority == HighestPriority) {
-				PriorityZones.Add(Zone);
+		if (GravityGroups[Group].NumActors == 0)
+		{
+			FreeGroup = FreeGroup == INDEX_NONE ? Group : FreeGroup;
+		}
+		else if (GravityGroups[Group].Gravity.Equals(Gravity, GravityGroupTolerance))
+		{
+			GravityGroups[Group].NumActors++;
+			return Group;
+		}
+	}
+	if (FreeGroup == INDEX_NONE) return INDEX_NONE;
 
-			}
-		}	
+	//The group's acceleration is set on the physics thread before the step that first sees its particles
+	FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+	Chaos::FPBDRigidsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+	if (!Solver) return INDEX_NONE;
+	Solver->EnqueueCommandImmediate([Solver, FreeGroup, Gravity]()
+	{
+		Solver->GetEvolution()->GetGravityForces().SetAcceleration(Gravity, FreeGroup);
+	});
+	GravityGroups[FreeGroup].Gravity = Gravity;
+	GravityGroups[FreeGroup].NumActors = 1;
+	return FreeGroup;
+}
+
+void UGravityManager::AssignGravityGroup(FActorSlot& ActorSlot, int32 Group)
+{
+	for (FBodyTarget& Target : ActorSlot.Bodies)
+	{
+		//Bodies that use world gravity are skipped, as they are on the force path
+		FBodyInstance* Body = Target.Body;
+		FSingleParticlePhysicsProxy* Handle = Body->GetPhysicsActorHandle();
+		if (!Handle || Body->bEnableGravity) continue;
+		Chaos::FRigidBodyHandle_External& Particle = Handle->GetGameThreadAPI();
+		Particle.SetGravityGroupIndex(Group);
+		Particle.SetGravityEnabled(true);
+		Target.GroupedHandle = Handle;
+		TickStats.BodiesTouched++;
+	}
+	ActorSlot.GravityGroup = Group;
+	ActorSlot.bGravityGroupDirty = false;
+}
+
+// Returns the actor's particles to world gravity settings, skipped when the bodies may already be gone
+void UGravityManager::ReleaseGravityGroup(FActorSlot& ActorSlot, bool bRestoreBodies)
+{
+	if (ActorSlot.GravityGroup == INDEX_NONE) return;
+	for (FBodyTarget& Target : ActorSlot.Bodies)
+	{
+		if (Target.GroupedHandle && bRestoreBodies)
+		{
+			Chaos::FRigidBodyHandle_External& Particle = Target.GroupedHandle->GetGameThreadAPI();
+			Particle.SetGravityGroupIndex(0);
+			Particle.SetGravityEnabled(Target.Body->bEnableGravity);
+			TickStats.BodiesTouched++;
+		}
+		Target.GroupedHandle = nullptr;
 	}
-	if (bIsCharacterGrounded) {
+	GravityGroups[ActorSlot.GravityGroup].NumActors--;
+	ActorSlot.GravityGroup = INDEX_NONE;
+	ActorSlot.bGravityGroupDirty = false;
+}
+
+// --- Gravity Application Logic ---
+FVector UGravityManager::CalculateNetGravityVectorForActor(const FActorSnapshot& Snapshot) const
+{
+	FVector NetGravity = FVector::ZeroVector;
+
+	//Samples were already filtered down to the highest priority zones during gather and evaluated by the zone kernels
+	if (Snapshot.bIsCharacterGrounded) {
 		FVector MaxGravityVector = FVector::ZeroVector;
-		for (AGravityZone* Zone : PriorityZones) {
-			FVector ZoneGravity = Zone->GetGravityVector(ActorLocation);
+		for (int32 SampleIndex = 0; SampleIndex < Snapshot.NumGravitySamples; ++SampleIndex) {
+			const FVector& ZoneGravity = GravitySamples[Snapshot.FirstGravitySample + SampleIndex].Gravity;
 			if (MaxGravityVector.Size() < ZoneGravity.Size()) {
 				MaxGravityVector = ZoneGravity;
 			}
 		}
+		if (Snapshot.bSampleNBody && MaxGravityVector.Size() < Snapshot.NBodyGravity.Size()) {
+			MaxGravityVector = Snapshot.NBodyGravity;
+		}
 		NetGravity = MaxGravityVector;
 	}
 	else {
-		NetGravity = FVector::ZeroVector;
-		for (AGravityZone* Zone : PriorityZones) {
-			FVector ZoneGravity = Zone->GetGravityVector(ActorLocation);
-			NetGravity += ZoneGravity;
+		for (int32 SampleIndex = 0; SampleIndex < Snapshot.NumGravitySamples; ++SampleIndex) {
+			NetGravity += GravitySamples[Snapshot.FirstGravitySample + SampleIndex].Gravity;
+		}
+		if (Snapshot.bSampleNBody) {
+			NetGravity += Snapshot.NBodyGravity;
 		}
 	}
 
 	return NetGravity;
 }
 
-FVector UGravityManager::CalculateMaxDampingVectorForActor(AActor* AffectedActor) const
+FVector UGravityManager::CalculateMaxDampingVectorForActor(const FActorSnapshot& Snapshot) const
 {
 	FVector MaxDamping = FVector::ZeroVector;
-	if (!AffectedActor) return MaxDamping;
-	FVector ActorLocation = AffectedActor->GetActorLocation();
-	const TSet<AGravityZone*>* OverlappingZones = ActorZoneOverlaps.Find(AffectedActor);
-	for (AGravityZone* Zone : *OverlappingZones) {
-		MaxDamping.X = FMath::Max(MaxDamping.X, Zone->GetLinearDampening(ActorLocation));
-		MaxDamping.Y = FMath::Max(MaxDamping.Y, Zone->GetAngularDampening(ActorLocation));
+	for (int32 SampleIndex = 0; SampleIndex < Snapshot.NumDampingSamples; ++SampleIndex) {
+		const FZoneSample& Sample = DampingSamples[Snapshot.FirstDampingSample + SampleIndex];
+		const FZoneSnapshot& Zone = ZoneSnapshots[Sample.ZoneIndex];
+		MaxDamping.X = FMath::Max(MaxDamping.X, Zone.bCustomDampening ? Sample.LinearDamping : Zone.LinearDamping);
+		MaxDamping.Y = FMath::Max(MaxDamping.Y, Zone.bCustomDampening ? Sample.AngularDamping : Zone.AngularDamping);
 		//Z could be used as a blend factor or multiplier or something...
 	}
 
 	return MaxDamping;
 }
 
-void UGravityManager::ApplyDampingToActorComponents(AActor* AffectedActor, const FVector& DampingVector)
+// --- Physics Target Cache ---
+void UGravityManager::RefreshActorTargets(FActorSlot& ActorSlot)
 {
-	if (!AffectedActor) return;
+	//Keep the original and last applied damping of bodies that survive the refresh
+	TArray<FBodyTarget, TInlineAllocator<1>> PreviousBodies = MoveTemp(ActorSlot.Bodies);
+	PreviousBodies.Add(ActorSlot.RootTarget);
+	auto MakeTarget = [&PreviousBodies](FBodyInstance* Body)
+	{
+		for (const FBodyTarget& Previous : PreviousBodies)
+		{
+			if (Previous.Body == Body) return Previous;
+		}
+		FBodyTarget Target;
+		Target.Body = Body;
+		Target.OriginalDamping = FVector2f(Body->LinearDamping, Body->AngularDamping);
+		return Target;
+	};
+
+	ActorSlot.MovementComp = nullptr;
+	ActorSlot.CharacterMesh = nullptr;
+	ActorSlot.RootTarget = FBodyTarget();
+	ActorSlot.Bodies.Reset();
+	ActorSlot.Pawn = Cast<APawn>(ActorSlot.Actor);
+	ActorSlot.bHasSignificantTag = !TierPolicy.SignificantTag.IsNone() && ActorSlot.Actor->ActorHasTag(TierPolicy.SignificantTag);
+
 	// --- Case 1: Third Person Gravity Character ---
-	if (ACharacter* Character = Cast<ACharacter>(AffectedActor))
+	if (ACharacter* Character = Cast<ACharacter>(ActorSlot.Actor))
 	{
-		USkeletalMeshComponent* SkMesh = Character->GetMesh();
-		if (SkMesh && SkMesh->IsSimulatingPhysics()) {
-			for (auto Body : SkMesh->Bodies) {
-				Body->LinearDamping = DampingVector.X;
-				Body->AngularDamping = DampingVector.Y;
+		ActorSlot.bIsCharacter = true;
+		ActorSlot.MovementComp = Character->GetCharacterMovement();
+		ActorSlot.CharacterMesh = Character->GetMesh();
+		if (UPrimitiveComponent* PrimRoot = Cast<UPrimitiveComponent>(Character->GetRootComponent()))
+		{
+			if (FBodyInstance* RootBody = PrimRoot->GetBodyInstance())
+			{
+				ActorSlot.RootTarget = MakeTarget(RootBody);
+			}
+		}
+		if (ActorSlot.CharacterMesh)
+		{
+			for (FBodyInstance* Body : ActorSlot.CharacterMesh->Bodies)
+			{
+				if (Body) ActorSlot.Bodies.Add(MakeTarget(Body));
 			}
-			return;
 		}
-		UPrimitiveComponent* PrimRoot = Cast<UPrimitiveComponent>(Character->GetRootComponent());
-		if (PrimRoot) {
-			PrimRoot->SetLinearDamping(DampingVector.X);
-			PrimRoot->SetAngularDamping(DampingVector.Y);
+	}
+	// --- Case 2: Primitive Components ---
+	else
+	{
+		ActorSlot.bIsCharacter = false;
+		TInlineComponentArray<UPrimitiveComponent*> PrimitiveComponents(ActorSlot.Actor);
+		for (UPrimitiveComponent* PrimComp : PrimitiveComponents)
+		{
+			if (FBodyInstance* Body = PrimComp ? PrimComp->GetBodyInstance() : nullptr)
+			{
+				ActorSlot.Bodies.Add(MakeTarget(Body));
+			}
 		}
-		return;
 	}
 
-	// --- Case 2: Primitive Components ---
-	TArray<UPrimitiveComponent*> PrimitiveComponents;
-	AffectedActor->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
-	for (UPrimitiveComponent* PrimComp : PrimitiveComponents)
+	//Particles recreated with the physics state start outside any group, the next tick moves them back in
+	if (ActorSlot.GravityGroup != INDEX_NONE)
 	{
-		if (PrimComp && PrimComp->IsSimulatingPhysics() && !PrimComp->IsGravityEnabled())
+		for (FBodyTarget& Target : ActorSlot.Bodies)
 		{
-			PrimComp->SetLinearDamping(DampingVector.X);
-			PrimComp->SetAngularDamping(DampingVector.Y);
+			if (Target.GroupedHandle != Target.Body->GetPhysicsActorHandle())
+			{
+				Target.GroupedHandle = nullptr;
+			}
 		}
+		ActorSlot.bGravityGroupDirty = true;
 	}
+	ActorSlot.bTargetsDirty = false;
 }
 
-void UGravityManager::ApplyGravityToActorComponents(AActor* AffectedActor, const FVector& NetGravityVector)
+void UGravityManager::OnComponentPhysicsStateChanged(UActorComponent* Component)
 {
-	if (!AffectedActor) return;
+	if (const int32* ActorIndex = ActorSlotIndices.Find(Component->GetOwner()))
+	{
+		ActorSlots[*ActorIndex].bTargetsDirty = true;
+	}
+}
+
+// Writes damping only when it differs from the last value this manager applied to the body
+void UGravityManager::ApplyBodyDamping(FBodyTarget& Target, const FVector2f& Damping)
+{
+	if (Target.bDampingApplied && Target.AppliedDamping == Damping) return;
+	Target.Body->LinearDamping = Damping.X;
+	Target.Body->AngularDamping = Damping.Y;
+	Target.Body->UpdateDampingProperties();
+	Target.AppliedDamping = Damping;
+	Target.bDampingApplied = true;
+	TickStats.BodiesTouched++;
+}
+
+// Hands bodies back the damping they had before entering any zone
+void UGravityManager::RestoreActorDamping(FActorSlot& ActorSlot)
+{
+	if (ActorSlot.bTargetsDirty || !IsValid(ActorSlot.Actor)) return; //Cached bodies may no longer exist
+	auto Restore = [](FBodyTarget& Target)
+	{
+		if (Target.Body && Target.bDampingApplied)
+		{
+			Target.Body->LinearDamping = Target.OriginalDamping.X;
+			Target.Body->AngularDamping = Target.OriginalDamping.Y;
+			Target.Body->UpdateDampingProperties();
+			Target.bDampingApplied = false;
+		}
+	};
+	Restore(ActorSlot.RootTarget);
+	for (FBodyTarget& Target : ActorSlot.Bodies)
+	{
+		Restore(Target);
+	}
+}
+
+void UGravityManager::ApplyGravityToActor(FActorSlot& ActorSlot, const FActorSnapshot& Snapshot)
+{
+	//Bodies take gravity as a force over this frame's physics step, scaled up for the frames a reduced tier actor skipped.
+	//GetBodyMass already includes MassScale, it is the same mass the solver integrates and the sim callback reads
+	const FVector NetGravityVector = Snapshot.NetGravity * Snapshot.GravityTimeScale; //Movement components only need the direction and scale
+	const bool bApplyBodyGravity = !SimCallback; //In substep mode bodies are driven from the physics thread
 
 	// --- Case 1: Third Person Gravity Character ---
-	if (ACharacter* Character = Cast<ACharacter>(AffectedActor))
+	if (ActorSlot.bIsCharacter)
 	{
-		USkeletalMeshComponent* SkMesh = Character->GetMesh();
-		if (SkMesh && SkMesh->IsSimulatingPhysics()) {
-			for (auto Body : SkMesh->Bodies) {
-				Body->AddForce(Body->GetBodyMass() * Body->MassScale * NetGravityVector);
+		if (ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics()) {
+			if (bApplyBodyGravity && ActorSlot.GravityGroup == INDEX_NONE) {
+				for (FBodyTarget& Target : ActorSlot.Bodies) {
+					Target.Body->AddForce(Target.Body->GetBodyMass() * NetGravityVector);
+				}
+				TickStats.BodiesTouched += ActorSlot.Bodies.Num();
 			}
 			return;
-		} else if (UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement())
+		}
+		if (ActorSlot.MovementComp)
 		{
-			MovementComp->GravityScale = NetGravityVector.Size() / 980.0; // Assuming 1.0 is the default scale, 9.8 m/s as our baseline
-			auto gravDir = NetGravityVector.GetSafeNormal();
-			MovementComp->SetGravityDirection(gravDir.IsNearlyZero() ? Character->GetActorUpVector() * -1.0 : gravDir);
+			UCharacterMovementComponent* MovementComp = ActorSlot.MovementComp;
+			const float GravityScale = Snapshot.NetGravity.Size() / 980.0; // Assuming 1.0 is the default scale, 9.8 m/s as our baseline
+			if (MovementComp->GravityScale != GravityScale) {
+				MovementComp->GravityScale = GravityScale;
+			}
+			auto gravDir = Snapshot.NetGravity.GetSafeNormal();
+			const FVector GravityDirection = gravDir.IsNearlyZero() ? ActorSlot.Actor->GetActorUpVector() * -1.0 : gravDir;
+			if (MovementComp->GetGravityDirection() != GravityDirection) {
+				MovementComp->SetGravityDirection(GravityDirection);
+			}
+			TickStats.BodiesTouched++;
 		}
 		return;
 	}
 
 	// --- Case 2: Primitive Components ---
-	TArray<UPrimitiveComponent*> PrimitiveComponents;
-	AffectedActor->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
-	for (UPrimitiveComponent* PrimComp : PrimitiveComponents)
+	if (!bApplyBodyGravity || ActorSlot.GravityGroup != INDEX_NONE || NetGravityVector.IsNearlyZero()) return;
+	for (FBodyTarget& Target : ActorSlot.Bodies)
 	{
-		if (PrimComp && PrimComp->IsSimulatingPhysics() && !PrimComp->IsGravityEnabled())
+		FBodyInstance* Body = Target.Body;
+		if (!Body->IsInstanceSimulatingPhysics() || Body->bEnableGravity) continue;
+		const float Mass = Body->GetBodyMass();
+		if (Mass > KINDA_SMALL_NUMBER)
 		{
-			if (float Mass = PrimComp->GetMass() > KINDA_SMALL_NUMBER && !NetGravityVector.IsNearlyZero())
-			{
-				FVector GravityForce = NetGravityVector * Mass * PrimComp->GetMassScale();
-				PrimComp->AddImpulse(GravityForce, NAME_None, false);
+			Body->AddForce(NetGravityVector * Mass);
+			TickStats.BodiesTouched++;
+		}
+	}
+}
+
+void UGravityManager::ApplyDampingToActor(FActorSlot& ActorSlot, const FActorSnapshot& Snapshot)
+{
+	const FVector2f Damping(Snapshot.MaxDamping.X, Snapshot.MaxDamping.Y);
+
+	// --- Case 1: Third Person Gravity Character ---
+	if (ActorSlot.bIsCharacter)
+	{
+		if (ActorSlot.CharacterMesh && ActorSlot.CharacterMesh->IsSimulatingPhysics()) {
+			for (FBodyTarget& Target : ActorSlot.Bodies) {
+				ApplyBodyDamping(Target, Damping);
 			}
 		}
+		else if (ActorSlot.RootTarget.Body) {
+			ApplyBodyDamping(ActorSlot.RootTarget, Damping);
+		}
+		return;
+	}
+
+	// --- Case 2: Primitive Components ---
+	for (FBodyTarget& Target : ActorSlot.Bodies)
+	{
+		if (!Target.Body->IsInstanceSimulatingPhysics() || Target.Body->bEnableGravity) continue;
+		ApplyBodyDamping(Target, Damping);
 	}
 }
 
@@ -0,0 +1,180 @@
+// --- GravityMovementComponent.cpp ---
+#include "GravityMovementComponent.h"
+#include "GravityFrameComponent.h"
+#include "GravityManager.h"
+#include "GravityZone.h"
+#include "GameFramework/Character.h"
+
+UGravityMovementComponent::UGravityMovementComponent()
+{
+	bSampleGravityPerIteration = true;
+	ZoneSet = MakeShared<FGravityZoneSet>();
+}
+
+void UGravityMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	Manager = UGravityManager::GetGravityManagerSubsystem(this);
+	if (!GravityFrame.IsValid() && GetOwner())
+	{
+		GravityFrame = GetOwner()->FindComponentByClass<UGravityFrameComponent>();
+	}
+}
+
+void UGravityMovementComponent::SetGravityFrame(UGravityFrameComponent* InGravityFrame)
+{
+	GravityFrame = InGravityFrame;
+	ApplyGravityFrame();
+}
+
+void UGravityMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	RefreshZoneFields();
+
+	//The frame reads the direction just set, advancing here is a no-op if the controller already did this frame
+	if (UGravityFrameComponent* Frame = GravityFrame.Get())
+	{
+		Frame->Advance(DeltaTime);
+		ApplyGravityFrame();
+	}
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+// Orients the capsule by the shared frame instead of the raw direction SetGravityDirection derives the basis from
+void UGravityMovementComponent::ApplyGravityFrame()
+{
+	if (const UGravityFrameComponent* Frame = GravityFrame.Get())
+	{
+		GravityToWorldTransform = Frame->GetGravityToWorld();
+		WorldToGravityTransform = GravityToWorldTransform.Inverse();
+	}
+}
+
+float UGravityMovementComponent::GetGravityZ() const
+{
+	return bZoneGravity ? -float(ZoneGravitySize) * GravityScale : Super::GetGravityZ();
+}
+
+// Captures the fields of the zone set and sets the basis for the frame, with the same source and priority rules as the manager
+void UGravityMovementComponent::RefreshZoneFields()
+{
+	ZoneFields.Reset();
+	CustomZones.Reset();
+	const UGravityManager* GravityManager = Manager.Get();
+	bZoneGravity = GravityManager && GravityManager->UseGravity && ZoneSet->bTracked && UpdatedComponent;
+	if (!bZoneGravity) return;
+
+	const bool bSourcesActive = !ZoneSet->bReplicatedGravity && !ZoneSet->bIgnoreGravitySources && GravityManager->HasActiveGravitySources();
+	const int32 HighestPriority = bSourcesActive ? FMath::Max(ZoneSet->Priority, GravityManager->NBodyPriority) : ZoneSet->Priority;
+	bSampleSources = bSourcesActive && HighestPriority == GravityManager->NBodyPriority;
+	bSampleZones = !ZoneSet->bReplicatedGravity && HighestPriority == ZoneSet->Priority;
+	for (int32 ZoneIndex = 0; bSampleZones && ZoneIndex < ZoneSet->Zones.Num(); ++ZoneIndex)
+	{
+		if (const AGravityZone* Zone = ZoneSet->Zones[ZoneIndex].Get())
+		{
+			const FGravityFieldParams Field = Zone->GetFieldParams();
+			if (Field.Type == EGravityFieldType::Custom)
+			{
+				CustomZones.Add(ZoneSet->Zones[ZoneIndex]);
+			}
+			else
+			{
+				ZoneFields.Add(Field);
+			}
+		}
+	}
+
+	FrameGravity = SampleZoneGravity(UpdatedComponent->GetComponentLocation());
+	SetZoneGravity(FrameGravity);
+}
+
+FVector UGravityMovementComponent::SampleZoneGravity(const FVector& Position) const
+{
+	if (!bZoneGravity)
+	{
+		return GetGravityDirection() * -GetGravityZ();
+	}
+	if (ZoneSet->bReplicatedGravity)
+	{
+		return ZoneSet->ReplicatedGravity;
+	}
+
+	//Grounded characters take the strongest zone so overlapping zones do not pull them off the floor, falling ones the sum
+	const bool bGrounded = !IsFalling();
+	FVector NetGravity = FVector::ZeroVector;
+	auto Accumulate = [&NetGravity, bGrounded](const FVector& Gravity)
+	{
+		if (!bGrounded)
+		{
+			NetGravity += Gravity;
+		}
+		else if (Gravity.SizeSquared() > NetGravity.SizeSquared())
+		{
+			NetGravity = Gravity;
+		}
+	};
+	for (const FGravityFieldParams& Field : ZoneFields)
+	{
+		Accumulate(Field.Evaluate(Position));
+	}
+	for (const TWeakObjectPtr<AGravityZone>& Zone : CustomZones)
+	{
+		if (const AGravityZone* CustomZone = Zone.Get())
+		{
+			Accumulate(CustomZone->GetGravityVector(Position));
+		}
+	}
+	if (bSampleSources)
+	{
+		if (const UGravityManager* GravityManager = Manager.Get())
+		{
+			Accumulate(GravityManager->SampleGravitySources(Position, GetOwner()));
+		}
+	}
+	return NetGravity;
+}
+
+void UGravityMovementComponent::SetZoneGravity(const FVector& Gravity)
+{
+	//Zero gravity keeps the current direction so the basis does not snap
+	ZoneGravitySize = Gravity.Size();
+	if (ZoneGravitySize > UE_KINDA_SMALL_NUMBER)
+	{
+		const FVector Direction = Gravity / ZoneGravitySize;
+		if (!Direction.Equals(GetGravityDirection(), UE_KINDA_SMALL_NUMBER))
+		{
+			SetGravityDirection(Direction);
+			ApplyGravityFrame();
+		}
+	}
+}
+
+void UGravityMovementComponent::PhysFalling(float DeltaTime, int32 Iterations)
+{
+	if (!bZoneGravity || !bSampleGravityPerIteration)
+	{
+		Super::PhysFalling(DeltaTime, Iterations);
+		return;
+	}
+
+	//Hand the base integration one simulation step at a time, each starting from gravity at the current position
+	float RemainingTime = DeltaTime;
+	while (RemainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && HasValidData())
+	{
+		const float TimeTick = GetSimulationTimeStep(RemainingTime, Iterations + 1);
+		RemainingTime -= TimeTick;
+		SetZoneGravity(SampleZoneGravity(UpdatedComponent->GetComponentLocation()));
+		Super::PhysFalling(TimeTick, Iterations);
+		++Iterations;
+
+		//Landing inside the step already moved on to the new mode for the rest of that step, give it the rest of the frame too
+		if (!IsFalling())
+		{
+			if (RemainingTime >= MIN_TICK_TIME && HasValidData())
+			{
+				StartNewPhysics(RemainingTime, Iterations);
+			}
+			return;
+		}
+	}
+}
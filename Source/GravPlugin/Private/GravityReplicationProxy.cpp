@@ -0,0 +1,150 @@
+// --- GravityReplicationProxy.cpp ---
+#include "GravityReplicationProxy.h"
+#include "GravityManager.h"
+#include "GravityZone.h"
+#include "GravPluginLibrary/GravityKernel.h"
+#include "Math/Float16.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+namespace GravityReplication
+{
+	//Octahedral encoding lives in the kernel so the standalone tests cover the fold
+	FORCEINLINE uint32 PackDirection(const FVector& Direction)
+	{
+		return GravKernel::PackOctahedral({ Direction.X, Direction.Y, Direction.Z });
+	}
+
+	FORCEINLINE FVector UnpackDirection(uint32 Packed)
+	{
+		const GravKernel::FVec3 Direction = GravKernel::UnpackOctahedral(Packed);
+		return FVector(Direction.X, Direction.Y, Direction.Z);
+	}
+}
+
+// --- Replicated Item ---
+FVector FGravityReplicatedItem::GetGravity() const
+{
+	FFloat16 Magnitude;
+	Magnitude.Encoded = PackedMagnitude;
+	return GravityReplication::UnpackDirection(PackedDirection) * Magnitude.GetFloat();
+}
+
+bool FGravityReplicatedItem::SetGravity(const FVector& Gravity)
+{
+	const double Magnitude = Gravity.Size();
+	const uint16 NewMagnitude = FFloat16(float(Magnitude)).Encoded;
+	const uint32 NewDirection = Magnitude > UE_KINDA_SMALL_NUMBER ? GravityReplication::PackDirection(Gravity / Magnitude) : 0;
+	if (NewMagnitude == PackedMagnitude && NewDirection == PackedDirection) return false;
+	PackedMagnitude = NewMagnitude;
+	PackedDirection = NewDirection;
+	return true;
+}
+
+void FGravityReplicatedItem::PostReplicatedAdd(const FGravityReplicatedArray& InArraySerializer)
+{
+	InArraySerializer.Owner->OnItemReplicated(*this);
+}
+
+void FGravityReplicatedItem::PostReplicatedChange(const FGravityReplicatedArray& InArraySerializer)
+{
+	InArraySerializer.Owner->OnItemReplicated(*this);
+}
+
+void FGravityReplicatedItem::PreReplicatedRemove(const FGravityReplicatedArray& InArraySerializer)
+{
+	InArraySerializer.Owner->OnItemRemoved(*this);
+}
+
+// --- Proxy ---
+AGravityReplicationProxy::AGravityReplicationProxy()
+{
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	bNetLoadOnClient = false;
+	Replicated.Owner = this;
+}
+
+void AGravityReplicationProxy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AGravityReplicationProxy, Replicated, Params);
+}
+
+void AGravityReplicationProxy::BeginPlay()
+{
+	Super::BeginPlay();
+	if (UGravityManager* GravityManager = GetWorld()->GetSubsystem<UGravityManager>())
+	{
+		GravityManager->SetReplicationProxy(this);
+	}
+}
+
+void AGravityReplicationProxy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGravityManager* GravityManager = GetWorld()->GetSubsystem<UGravityManager>())
+	{
+		for (const FGravityReplicatedItem& Item : Replicated.Items)
+		{
+			GravityManager->ClearReplicatedGravity(Item.Actor);
+		}
+		GravityManager->SetReplicationProxy(nullptr);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void AGravityReplicationProxy::UpdateActor(AActor* AffectedActor, const FVector& Gravity, AGravityZone* Zone)
+{
+	int32& ItemIndex = ItemIndices.FindOrAdd(AffectedActor, INDEX_NONE);
+	if (ItemIndex == INDEX_NONE)
+	{
+		ItemIndex = Replicated.Items.AddDefaulted();
+		Replicated.Items[ItemIndex].Actor = AffectedActor;
+	}
+
+	//Only items whose packed state changed are marked, which is what keeps the update delta only
+	FGravityReplicatedItem& Item = Replicated.Items[ItemIndex];
+	const bool bGravityChanged = Item.SetGravity(Gravity);
+	if (bGravityChanged || Item.Zone != Zone || Item.ReplicationID == INDEX_NONE)
+	{
+		Item.Zone = Zone;
+		Replicated.MarkItemDirty(Item);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AGravityReplicationProxy, Replicated, this);
+	}
+}
+
+void AGravityReplicationProxy::RemoveActor(AActor* AffectedActor)
+{
+	int32 ItemIndex = INDEX_NONE;
+	if (!ItemIndices.RemoveAndCopyValue(AffectedActor, ItemIndex)) return;
+
+	const int32 LastIndex = Replicated.Items.Num() - 1;
+	if (ItemIndex != LastIndex)
+	{
+		ItemIndices.Add(Replicated.Items[LastIndex].Actor, ItemIndex);
+	}
+	Replicated.Items.RemoveAtSwap(ItemIndex, 1, EAllowShrinking::No);
+	Replicated.MarkArrayDirty();
+	MARK_PROPERTY_DIRTY_FROM_NAME(AGravityReplicationProxy, Replicated, this);
+}
+
+void AGravityReplicationProxy::OnItemReplicated(const FGravityReplicatedItem& Item)
+{
+	//Actors that are not relevant to this connection resolve to null and keep their local gravity
+	if (!Item.Actor) return;
+	if (UGravityManager* GravityManager = GetWorld()->GetSubsystem<UGravityManager>())
+	{
+		GravityManager->ApplyReplicatedGravity(Item.Actor, Item.GetGravity());
+	}
+}
+
+void AGravityReplicationProxy::OnItemRemoved(const FGravityReplicatedItem& Item)
+{
+	if (UGravityManager* GravityManager = GetWorld()->GetSubsystem<UGravityManager>())
+	{
+		GravityManager->ClearReplicatedGravity(Item.Actor);
+	}
+}
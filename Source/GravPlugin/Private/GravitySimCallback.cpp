@@ -0,0 +1,26 @@
+// --- GravitySimCallback.cpp ---
+#include "GravitySimCallback.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+
+void FGravitySimCallback::OnPreSimulate_Internal()
+{
+	const FGravitySimInput* Input = GetConsumerInput_Internal();
+	if (!Input) return;
+
+	for (const FGravitySimBody& SimBody : Input->Bodies)
+	{
+		Chaos::FRigidBodyHandle_Internal* Handle = SimBody.Proxy ? SimBody.Proxy->GetPhysicsThreadAPI() : nullptr;
+
+		//Sleeping and kinematic bodies are left alone so gravity never wakes them
+		if (!Handle || Handle->ObjectState() != Chaos::EObjectStateType::Dynamic) continue;
+
+		const FVector Position = Handle->X();
+		FVector Gravity = SimBody.ConstantGravity;
+		for (int32 ZoneIndex = SimBody.FirstZone; ZoneIndex < SimBody.FirstZone + SimBody.NumZones; ++ZoneIndex)
+		{
+			Gravity += Input->Zones[Input->BodyZones[ZoneIndex]].Evaluate(Position);
+		}
+		//Same force the game thread path adds once per frame, M() already includes the body's mass scale
+		Handle->AddForce(Gravity * Handle->M());
+	}
+}
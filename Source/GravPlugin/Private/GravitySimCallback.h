@@ -0,0 +1,49 @@
+// --- GravitySimCallback.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/SimCallbackInput.h"
+#include "GravityField.h"
+
+class FSingleParticlePhysicsProxy;
+
+// A rigid body driven on the physics thread, zones reference FGravitySimInput::Zones
+struct FGravitySimBody
+{
+	FSingleParticlePhysicsProxy* Proxy = nullptr;
+	int32 FirstZone = 0;
+	int32 NumZones = 0;
+	FVector ConstantGravity = FVector::ZeroVector; //Custom zone contribution, sampled on the game thread and held for every substep
+};
+
+// Zone and body snapshot produced once per game frame
+struct FGravitySimInput : public Chaos::FSimCallbackInput
+{
+	TArray<FGravityFieldParams> Zones;
+	TArray<int32> BodyZones;
+	TArray<FGravitySimBody> Bodies;
+
+	void Reset()
+	{
+		Zones.Reset();
+		BodyZones.Reset();
+		Bodies.Reset();
+	}
+};
+
+struct FGravitySimOutput : public Chaos::FSimCallbackOutput
+{
+	void Reset() {}
+};
+
+/**
+ * Applies zone gravity as an acceleration before every physics step, so substeps each see the field at the
+ * body's current position and the result does not depend on the game frame rate.
+ */
+class FGravitySimCallback : public Chaos::TSimCallbackObject<FGravitySimInput, FGravitySimOutput, Chaos::ESimCallbackOptions::Presimulate>
+{
+private:
+	virtual void OnPreSimulate_Internal() override;
+};
@@ -0,0 +1,33 @@
+// --- GravitySourceComponent.cpp ---
+#include "GravitySourceComponent.h"
+#include "GravityManager.h"
+
+UGravitySourceComponent::UGravitySourceComponent()
+{
+	Mass = 1.5e15; //Roughly 1g at 100m with the physical gravitational constant
+	bAffectedByOtherSources = true;
+}
+
+void UGravitySourceComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>())
+		{
+			GravityManager->RegisterGravitySource(this);
+		}
+	}
+}
+
+void UGravitySourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>())
+		{
+			GravityManager->UnregisterGravitySource(this);
+		}
+	}
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,203 @@
+// --- GravityTrajectory.cpp ---
+#include "GravityTrajectory.h"
+#include "GravityFieldSnapshot.h"
+#include "GravityStats.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+
+// --- Buffer ---
+void FGravityTrajectoryBuffer::Reset(int32 NumTrajectories, int32 NumSteps)
+{
+	Stride = NumSteps + 1;
+	Points.SetNumUninitialized(NumTrajectories * Stride, EAllowShrinking::No);
+	NumPoints.SetNumUninitialized(NumTrajectories, EAllowShrinking::No);
+	Hits.SetNum(NumTrajectories, EAllowShrinking::No);
+}
+
+void FGravityTrajectoryBuffer::ToBlueprint(TArray<FGravityTrajectory>& OutTrajectories) const
+{
+	OutTrajectories.SetNum(Num());
+	for (int32 Trajectory = 0; Trajectory < Num(); ++Trajectory)
+	{
+		FGravityTrajectory& Out = OutTrajectories[Trajectory];
+		Out.Points = GetPoints(Trajectory);
+		Out.bHit = Hits[Trajectory].bBlockingHit;
+		Out.Hit = Hits[Trajectory];
+	}
+}
+
+// --- Predictor ---
+FGravityTrajectoryPredictor::FGravityTrajectoryPredictor(const FGravityFieldSnapshot* InSnapshot, const UWorld* InCollisionWorld, const FGravityTrajectoryParams& Params)
+	: Snapshot(InSnapshot)
+	, CollisionWorld(Params.bSweepCollision ? InCollisionWorld : nullptr)
+	, Integrator(Params.Integrator)
+	, TimeStep(FMath::Max(double(Params.TimeStep), UE_KINDA_SMALL_NUMBER))
+	, NumSteps(FMath::Max(Params.NumSteps, 1))
+	, bApplyZoneDamping(Params.bApplyZoneDamping)
+	, CollisionChannel(Params.CollisionChannel)
+	, CollisionShape(Params.CollisionRadius > 0.f ? FCollisionShape::MakeSphere(Params.CollisionRadius) : FCollisionShape())
+	, QueryParams(SCENE_QUERY_STAT(GravityTrajectory), false)
+{
+	for (const AActor* IgnoredActor : Params.ActorsToIgnore)
+	{
+		QueryParams.AddIgnoredActor(IgnoredActor);
+	}
+}
+
+void FGravityTrajectoryPredictor::Predict(TConstArrayView<FGravityTrajectoryStart> Starts, FGravityTrajectoryBuffer& OutBuffer) const
+{
+	GRAVITY_SCOPE_CYCLE_COUNTER(STAT_GravityTrajectories);
+
+	const int32 NumTrajectories = Starts.Num();
+	OutBuffer.Reset(NumTrajectories, NumSteps);
+	if (NumTrajectories == 0) return;
+
+	const int32 Chunk = FMath::Max(ChunkSize, 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTrajectories, Chunk);
+	const EParallelForFlags Flags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	ParallelFor(TEXT("GravityTrajectory.Predict"), NumChunks, 1, [this, Starts, Chunk, NumTrajectories, &OutBuffer](int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * Chunk;
+		const int32 Num = FMath::Min(Chunk, NumTrajectories - First);
+		const double H = TimeStep;
+
+		//Working memory for the chunk, sized once up front so the steps themselves do not allocate. State is indexed by
+		//trajectory within the chunk, stage buffers by lane, where lanes are the trajectories still in flight
+		FGravityFieldSnapshot::FBatchScratch Scratch;
+		TArray<FVector> Position, Velocity, StagePosition, StageGravity, DeltaPosition, DeltaVelocity, StageVelocity;
+		TArray<FVector2f> StageDamping;
+		TArray<float> LinearDamping;
+		TArray<int32> Active;
+		for (TArray<FVector>* Array : { &Position, &Velocity, &StagePosition, &StageGravity, &DeltaPosition, &DeltaVelocity, &StageVelocity })
+		{
+			Array->SetNumUninitialized(Num);
+		}
+		StageDamping.SetNumUninitialized(Num);
+		LinearDamping.SetNumUninitialized(Num);
+		Active.Reserve(Num);
+
+		for (int32 Local = 0; Local < Num; ++Local)
+		{
+			const int32 Trajectory = First + Local;
+			Position[Local] = Starts[Trajectory].Position;
+			Velocity[Local] = Starts[Trajectory].Velocity;
+			OutBuffer.Points[Trajectory * OutBuffer.Stride] = Position[Local];
+			OutBuffer.NumPoints[Trajectory] = 1;
+			OutBuffer.Hits[Trajectory] = FHitResult();
+			Active.Add(Local);
+		}
+
+		//Gravity and damping at StagePosition for every lane
+		auto SampleStage = [&]()
+		{
+			const int32 NumLanes = Active.Num();
+			if (Snapshot)
+			{
+				Snapshot->SampleBatch(MakeArrayView(StagePosition.GetData(), NumLanes), MakeArrayView(StageGravity.GetData(), NumLanes),
+					MakeArrayView(StageDamping.GetData(), NumLanes), Scratch);
+			}
+			else
+			{
+				for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					StageGravity[Lane] = FVector::ZeroVector;
+					StageDamping[Lane] = FVector2f::ZeroVector;
+				}
+			}
+		};
+
+		for (int32 Step = 0; Step < NumSteps && Active.Num() > 0; ++Step)
+		{
+			const int32 NumLanes = Active.Num();
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+			{
+				StagePosition[Lane] = Position[Active[Lane]];
+			}
+			SampleStage();
+
+			if (Integrator == EGravityTrajectoryIntegrator::RK4)
+			{
+				//Stage k samples at P + V(k-1) * Offset, where V(k-1) = V + A(k-1) * Offset, and the derivatives are summed with weights 1, 2, 2, 1
+				static constexpr double StageOffsets[3] = { 0.5, 0.5, 1.0 };
+				for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					const int32 Local = Active[Lane];
+					DeltaPosition[Lane] = Velocity[Local];
+					DeltaVelocity[Lane] = StageGravity[Lane];
+					StageVelocity[Lane] = Velocity[Local];
+				}
+				//Damping is taken at the start of the step, before the later stages overwrite it
+				for (int32 Lane = 0; bApplyZoneDamping && Lane < NumLanes; ++Lane)
+				{
+					LinearDamping[Lane] = StageDamping[Lane].X;
+				}
+				for (int32 Stage = 0; Stage < 3; ++Stage)
+				{
+					const double Offset = StageOffsets[Stage] * H;
+					const double Weight = Stage < 2 ? 2.0 : 1.0;
+					for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+					{
+						const int32 Local = Active[Lane];
+						StagePosition[Lane] = Position[Local] + StageVelocity[Lane] * Offset;
+						StageVelocity[Lane] = Velocity[Local] + StageGravity[Lane] * Offset;
+					}
+					SampleStage();
+					for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+					{
+						DeltaPosition[Lane] += StageVelocity[Lane] * Weight;
+						DeltaVelocity[Lane] += StageGravity[Lane] * Weight;
+					}
+				}
+				for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					const int32 Local = Active[Lane];
+					StagePosition[Lane] = Position[Local] + DeltaPosition[Lane] * (H / 6.0);
+					Velocity[Local] += DeltaVelocity[Lane] * (H / 6.0);
+					if (bApplyZoneDamping)
+					{
+						Velocity[Local] /= 1.0 + LinearDamping[Lane] * H;
+					}
+				}
+			}
+			else
+			{
+				for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+				{
+					const int32 Local = Active[Lane];
+					Velocity[Local] += StageGravity[Lane] * H;
+					if (bApplyZoneDamping)
+					{
+						Velocity[Local] /= 1.0 + StageDamping[Lane].X * H;
+					}
+					StagePosition[Lane] = Position[Local] + Velocity[Local] * H;
+				}
+			}
+
+			//StagePosition now holds the end of the step, sweep towards it and retire the lanes that hit something.
+			//Walking backwards lets finished lanes swap out of Active without skipping any
+			for (int32 Lane = NumLanes - 1; Lane >= 0; --Lane)
+			{
+				const int32 Local = Active[Lane];
+				const int32 Trajectory = First + Local;
+				FVector NextPosition = StagePosition[Lane];
+				bool bFinished = Step == NumSteps - 1;
+				if (CollisionWorld)
+				{
+					FHitResult& Hit = OutBuffer.Hits[Trajectory];
+					if (CollisionWorld->SweepSingleByChannel(Hit, Position[Local], NextPosition, FQuat::Identity, CollisionChannel, CollisionShape, QueryParams))
+					{
+						NextPosition = Hit.Location;
+						bFinished = true;
+					}
+				}
+				Position[Local] = NextPosition;
+				OutBuffer.Points[Trajectory * OutBuffer.Stride + Step + 1] = NextPosition;
+				OutBuffer.NumPoints[Trajectory] = Step + 2;
+				if (bFinished)
+				{
+					Active.RemoveAtSwap(Lane, 1, EAllowShrinking::No);
+				}
+			}
+		}
+	}, Flags);
+}
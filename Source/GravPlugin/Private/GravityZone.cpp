@@ -2,6 +2,10 @@
 
 
 #include "GravityZone.h"
+#include "GravityFieldAsset.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
 
 // Sets default values
 AGravityZone::AGravityZone()
@@ -9,10 +13,39 @@ AGravityZone::AGravityZone()
 	PrimaryActorTick.bCanEverTick = true;
 	Priority = 0;
 	BaseVector = FVector(0, 0, -980);
+	FieldType = EGravityFieldType::Custom;
+	FieldRadius = 100;
+	FalloffExponent = 2;
 	LinearDamping = .05;
 	AngularDamping = .1;
 }
 
+void AGravityZone::PostInitProperties()
+{
+	Super::PostInitProperties();
+	bCustomGravityVector = IsEventOverridden(GET_FUNCTION_NAME_CHECKED(AGravityZone, GetGravityVector));
+	bCustomDampening = IsEventOverridden(GET_FUNCTION_NAME_CHECKED(AGravityZone, GetLinearDampening))
+		|| IsEventOverridden(GET_FUNCTION_NAME_CHECKED(AGravityZone, GetAngularDampening));
+}
+
+bool AGravityZone::IsEventOverridden(FName EventName) const
+{
+	//A Blueprint override lives in the generated class rather than in AGravityZone
+	const UFunction* Function = GetClass()->FindFunctionByName(EventName);
+	if (!Function || Function->GetOuter() != AGravityZone::StaticClass())
+	{
+		return true;
+	}
+
+	//Native subclasses can override the _Implementation, treat them as custom unless they are AGravityZone itself
+	const UClass* NativeClass = GetClass();
+	while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+	return NativeClass != AGravityZone::StaticClass();
+}
+
 // Called when the game starts or when spawned
 void AGravityZone::BeginPlay()
 {
@@ -38,6 +71,45 @@ void AGravityZone::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+#if WITH_EDITOR
+void AGravityZone::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(AGravityZone, Priority))
+	{
+		SetPriority(Priority);
+	}
+}
+#endif
+
+void AGravityZone::SetPriority(int NewPriority)
+{
+	Priority = NewPriority;
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>())
+		{
+			GravityManager->NotifyZonePriorityChanged(this);
+		}
+	}
+}
+
+void AGravityZone::SetExclusionTags(const TArray<FString>& NewExclusionTags)
+{
+	ExclusionTags = NewExclusionTags;
+	if (UWorld* World = GetWorld())
+	{
+		if (UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>())
+		{
+			TArray<FName, TInlineAllocator<4>> TagNames;
+			for (const FString& ExclusionTag : ExclusionTags)
+			{
+				TagNames.Add(FName(*ExclusionTag));
+			}
+			GravityManager->NotifyZoneExclusionTagsChanged(this, TagNames);
+		}
+	}
+}
 
 void AGravityZone::OnZoneBeginOverlap(AActor* OtherActor)
 {
@@ -72,5 +144,64 @@ double AGravityZone::GetAngularDampening_Implementation(const FVector& InWorldPo
 
 FVector AGravityZone::GetGravityVector_Implementation(const FVector& InWorldLocation) const
 {
-	return BaseVector;
+	return GetFieldParams().Evaluate(InWorldLocation);
+}
+
+EGravityFieldType AGravityZone::GetEffectiveFieldType() const
+{
+	if (FieldType == EGravityFieldType::Custom && !HasCustomGravityVector())
+	{
+		return EGravityFieldType::Uniform;
+	}
+	return FieldType;
+}
+
+FGravityFieldParams AGravityZone::GetFieldParams() const
+{
+	FGravityFieldParams Params;
+	Params.Type = GetEffectiveFieldType();
+	Params.BaseVector = BaseVector;
+	Params.Origin = GetActorLocation();
+	Params.Axis = GetActorUpVector();
+	Params.Strength = BaseVector.Size();
+	Params.Radius = FieldRadius;
+	Params.FalloffExponent = FalloffExponent;
+	Params.Rotation = GetActorQuat();
+	Params.Grid = FieldAsset ? FieldAsset->GetSharedGrid() : nullptr;
+	return Params;
+}
+
+void AGravityZone::GetZoneVolumes(TArray<FGravityZoneVolume, TInlineAllocator<1>>& OutVolumes) const
+{
+	OutVolumes.Reset();
+	TInlineComponentArray<UPrimitiveComponent*> PrimitiveComponents(this);
+	for (const UPrimitiveComponent* PrimComp : PrimitiveComponents)
+	{
+		if (!PrimComp || !PrimComp->GetGenerateOverlapEvents()) continue;
+
+		FGravityZoneVolume& Volume = OutVolumes.AddDefaulted_GetRef();
+		Volume.Center = PrimComp->GetComponentLocation();
+		Volume.Rotation = PrimComp->GetComponentQuat();
+		if (const USphereComponent* Sphere = Cast<USphereComponent>(PrimComp))
+		{
+			Volume.Shape = FGravityZoneVolume::EShape::Sphere;
+			Volume.Extent = FVector(Sphere->GetScaledSphereRadius(), 0, 0);
+		}
+		else if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(PrimComp))
+		{
+			Volume.Shape = FGravityZoneVolume::EShape::Capsule;
+			Volume.Extent = FVector(Capsule->GetScaledCapsuleRadius(), 0, Capsule->GetScaledCapsuleHalfHeight());
+		}
+		else if (const UBoxComponent* Box = Cast<UBoxComponent>(PrimComp))
+		{
+			Volume.Extent = Box->GetScaledBoxExtent();
+		}
+		else
+		{
+			//No analytic form, fall back to the world bounds
+			Volume.Center = PrimComp->Bounds.Origin;
+			Volume.Rotation = FQuat::Identity;
+			Volume.Extent = PrimComp->Bounds.BoxExtent;
+		}
+	}
 }
@@ -11,8 +11,4 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
-
-private:
-	/** Handle to the test dll we will load */
-	void*	ExampleLibraryHandle;
 };
@@ -0,0 +1,63 @@
+// --- GravityBarnesHut.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Barnes-Hut octree over a set of point masses. Built once per tick on the game thread, after which Evaluate
+ * can be called from any number of threads. Distant cells are replaced by their center of mass whenever
+ * CellSize / Distance < Theta, so a full evaluation of N bodies costs O(N log N) instead of O(N^2).
+ */
+class GRAVPLUGIN_API FGravityBarnesHutTree
+{
+public:
+	//Keys let Evaluate skip the bodies belonging to the object being sampled, INDEX_NONE matches nothing
+	void Build(TConstArrayView<FVector> Positions, TConstArrayView<double> Masses, TConstArrayView<int32> Keys);
+	void Reset();
+
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	int32 NumBodies() const { return Bodies.Num(); }
+
+	//Acceleration at Position from every body whose key differs from ExcludeKey
+	FVector Evaluate(const FVector& Position, int32 ExcludeKey, double Theta, double GravitationalConstant, double Softening) const;
+
+	//Reference O(N) sum over every body, used to measure the approximation error
+	FVector EvaluateBruteForce(const FVector& Position, int32 ExcludeKey, double GravitationalConstant, double Softening) const;
+
+private:
+	struct FBody
+	{
+		FVector Position;
+		double Mass;
+		int32 Key;
+	};
+
+	struct FNode
+	{
+		FVector Center;              //Cell center
+		double HalfSize = 0.0;
+		FVector CenterOfMass = FVector::ZeroVector;
+		double Mass = 0.0;
+		int32 FirstChild = INDEX_NONE; //Children are stored contiguously, INDEX_NONE for leaves
+		int32 NumChildren = 0;
+		int32 FirstBody = 0;           //Leaf bodies, a range of Bodies
+		int32 NumBodies = 0;
+	};
+
+	static constexpr int32 MaxLeafBodies = 4;
+	static constexpr int32 MaxDepth = 24;
+
+	void BuildNode(int32 NodeIndex, int32 Depth);
+
+	static FORCEINLINE FVector PointAcceleration(const FVector& Position, const FVector& MassPosition, double Mass, double GravitationalConstant, double SofteningSquared)
+	{
+		const FVector ToMass = MassPosition - Position;
+		const double DistanceSquared = ToMass.SizeSquared() + SofteningSquared;
+		return ToMass * (GravitationalConstant * Mass / (DistanceSquared * FMath::Sqrt(DistanceSquared)));
+	}
+
+	TArray<FNode> Nodes;
+	TArray<FBody> Bodies;      //Reordered so every node covers a contiguous range
+	TArray<FBody> Scratch;
+};
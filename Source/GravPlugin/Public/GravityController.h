@@ -4,6 +4,8 @@
 #include "GameFramework/PlayerController.h"
 #include "GravityController.generated.h"
 
+class UGravityFrameComponent;
+
 /**
  * A Player Controller class which adds input-handling functionality for
  * CharacterMovementController's custom gravity mechanics.
@@ -16,10 +18,9 @@ class AGravityController : public APlayerController
 public:
 	double Pitch = 0; //Track input pitch accumulation independantly from controller rotation
 	double MaxPitch = 70; //Max camera pitch, at >= 90 gimbal locking can occur
-	double DeltaSmoothing = .1; //Estimated duration of transition between gravity vectors in seconds
-
-	FVector TransitionGravityDirection = FVector::DownVector;
+	double DeltaSmoothing = .1; //Estimated duration of transition between gravity vectors in seconds, used for pawns without their own UGravityFrameComponent
 
+	virtual void SetPawn(APawn* InPawn) override;
 	virtual void UpdateRotation(float DeltaTime) override;
 
 	// Converts a rotation from world space to gravity relative space.
@@ -31,5 +32,6 @@ public:
 	static FRotator GetGravityWorldRotation(FRotator Rotation, FVector GravityDirection);
 
 private:
-	FVector LastFrameGravity = FVector::ZeroVector;
+	UPROPERTY(Transient)
+	TObjectPtr<UGravityFrameComponent> GravityFrame;
 };
\ No newline at end of file
@@ -0,0 +1,208 @@
+// --- GravityField.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GravPluginLibrary/GravityKernel.h"
+#include "GravityField.generated.h"
+
+/**
+ * Built-in gravity field shapes a zone can select, evaluated natively by the manager.
+ * Custom keeps the old behaviour of calling the GetGravityVector event.
+ */
+UENUM(BlueprintType)
+enum class EGravityFieldType : uint8
+{
+	Custom      UMETA(ToolTip = "Calls GetGravityVector, override it in Blueprint for custom logic"),
+	Uniform     UMETA(ToolTip = "BaseVector everywhere inside the zone"),
+	Radial      UMETA(ToolTip = "Pulls towards the zone origin, like a planet"),
+	Cylindrical UMETA(ToolTip = "Pulls towards the zone up axis through the origin"),
+	Planar      UMETA(ToolTip = "Pulls towards the plane through the origin facing the zone up axis"),
+	BakedGrid   UMETA(ToolTip = "Samples the zone's baked UGravityFieldAsset, for fields too complex to evaluate analytically")
+};
+
+/**
+ * Storage format of the samples in a baked gravity grid.
+ */
+UENUM(BlueprintType)
+enum class EGravityFieldPrecision : uint8
+{
+	Quantized16 UMETA(ToolTip = "16 bit integers scaled by the largest component in the field, uniform absolute error"),
+	Half        UMETA(ToolTip = "16 bit floats, relative error that keeps detail in weak regions of the field")
+};
+
+/**
+ * Sparse bricked grid of gravity vectors in a zone's local space. Bricks whose samples are all within the bake
+ * tolerance of each other collapse to a single value, so empty space and far field regions cost almost nothing.
+ */
+USTRUCT()
+struct GRAVPLUGIN_API FGravityFieldGrid
+{
+	GENERATED_BODY()
+
+	static constexpr int32 BrickSize = 8;
+	static constexpr int32 BrickSamples = BrickSize * BrickSize * BrickSize;
+
+	//Local position of the first sample
+	UPROPERTY()
+	FVector3f Origin = FVector3f::ZeroVector;
+
+	//Distance between neighbouring samples
+	UPROPERTY()
+	float VoxelSize = 100.f;
+
+	UPROPERTY()
+	FIntVector NumBricks = FIntVector::ZeroValue;
+
+	UPROPERTY()
+	EGravityFieldPrecision Precision = EGravityFieldPrecision::Quantized16;
+
+	//Value of one quantization step for Quantized16 grids
+	UPROPERTY()
+	float QuantizationScale = 1.f;
+
+	//Per brick, an index into BrickData when >= 0, otherwise -(Index + 1) into ConstantData
+	UPROPERTY()
+	TArray<int32> BrickTable;
+
+	//Encoded XYZ triplets, BrickSamples of them per stored brick
+	UPROPERTY()
+	TArray<uint16> BrickData;
+
+	//One encoded XYZ triplet per collapsed brick
+	UPROPERTY()
+	TArray<uint16> ConstantData;
+
+	bool IsValid() const { return BrickTable.Num() > 0; }
+
+	//Trilinearly interpolated gravity at a local position, zero outside the grid
+	FVector Sample(const FVector& LocalPosition) const;
+
+	//Size of the encoded data in bytes
+	int64 GetDataSize() const { return BrickTable.GetAllocatedSize() + BrickData.GetAllocatedSize() + ConstantData.GetAllocatedSize(); }
+
+private:
+	FVector3f FetchSample(int32 X, int32 Y, int32 Z) const;
+	FVector3f Decode(const uint16* Encoded) const;
+};
+
+/**
+ * Plain data description of a native gravity field. Captured from a zone on the game thread,
+ * after which it can be evaluated from any thread.
+ */
+struct GRAVPLUGIN_API FGravityFieldParams
+{
+	EGravityFieldType Type = EGravityFieldType::Uniform;
+	FVector BaseVector = FVector(0, 0, -980); //Used directly by uniform fields
+	FVector Origin = FVector::ZeroVector;     //Field center in world space
+	FVector Axis = FVector::UpVector;         //Unit axis used by cylindrical and planar fields
+	double Strength = 980.0;                  //Acceleration at or inside Radius
+	double Radius = 100.0;                    //Distance at which falloff starts
+	double FalloffExponent = 2.0;             //0 = constant, 2 = inverse square
+	FQuat Rotation = FQuat::Identity;         //Local frame of baked grid fields
+	TSharedPtr<const FGravityFieldGrid, ESPMode::ThreadSafe> Grid; //Baked samples, shared with the zone's field asset
+
+	//Gravity at a world position
+	FORCEINLINE FVector Evaluate(const FVector& Position) const
+	{
+		if (Type == EGravityFieldType::BakedGrid)
+		{
+			return Grid ? Rotation.RotateVector(Grid->Sample(Rotation.UnrotateVector(Position - Origin))) : FVector::ZeroVector;
+		}
+		const GravKernel::FVec3 Gravity = GravKernel::Evaluate(ToKernel(), { Position.X, Position.Y, Position.Z });
+		return FVector(Gravity.X, Gravity.Y, Gravity.Z);
+	}
+
+	//Evaluates Num positions stored as separate X, Y and Z arrays, several lanes at a time. Lanes whose
+	//LanePriority is above Priority belong to a higher priority zone and receive a zero vector, a null
+	//LanePriority evaluates every lane
+	void EvaluateBatch(int32 Priority, const double* X, const double* Y, const double* Z, const double* LanePriority,
+		double* OutX, double* OutY, double* OutZ, int32 Num) const;
+
+	//Field magnitude at a distance from the origin, axis or plane
+	FORCEINLINE double GetFalloffStrength(double Distance) const
+	{
+		return GravKernel::GetFalloffStrength(ToKernel(), Distance);
+	}
+
+	//Analytic part of the field in the engine free form evaluated by GravPluginLibrary. Custom fields that reach
+	//native evaluation behave as uniform, baked grids are sampled here instead
+	FORCEINLINE GravKernel::FFieldParams ToKernel() const
+	{
+		GravKernel::FFieldParams Kernel;
+		switch (Type)
+		{
+		case EGravityFieldType::Radial:      Kernel.Type = GravKernel::EFieldType::Radial; break;
+		case EGravityFieldType::Cylindrical: Kernel.Type = GravKernel::EFieldType::Cylindrical; break;
+		case EGravityFieldType::Planar:      Kernel.Type = GravKernel::EFieldType::Planar; break;
+		default:                             Kernel.Type = GravKernel::EFieldType::Uniform; break;
+		}
+		Kernel.BaseVector = { BaseVector.X, BaseVector.Y, BaseVector.Z };
+		Kernel.Origin = { Origin.X, Origin.Y, Origin.Z };
+		Kernel.Axis = { Axis.X, Axis.Y, Axis.Z };
+		Kernel.Strength = Strength;
+		Kernel.Radius = Radius;
+		Kernel.FalloffExponent = FalloffExponent;
+		return Kernel;
+	}
+};
+
+/**
+ * Analytic copy of one of a zone's collision shapes, used to resolve zone membership from a position
+ * without overlap events. Boxes also stand in for shapes without an analytic form, using their bounds.
+ */
+struct GRAVPLUGIN_API FGravityZoneVolume
+{
+	enum class EShape : uint8
+	{
+		Box,
+		Sphere,
+		Capsule
+	};
+
+	EShape Shape = EShape::Box;
+	FVector Center = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Extent = FVector::ZeroVector; //Box half extents, X is the radius and Z the half height for spheres and capsules
+
+	//True if a world position lies inside the shape
+	FORCEINLINE bool Contains(const FVector& Position) const
+	{
+		const FVector Local = Rotation.UnrotateVector(Position - Center);
+		switch (Shape)
+		{
+		case EShape::Sphere:
+			return Local.SizeSquared() <= FMath::Square(Extent.X);
+		case EShape::Capsule:
+		{
+			const double SegmentHalfLength = FMath::Max(Extent.Z - Extent.X, 0.0);
+			const FVector Closest(0, 0, FMath::Clamp(Local.Z, -SegmentHalfLength, SegmentHalfLength));
+			return FVector::DistSquared(Local, Closest) <= FMath::Square(Extent.X);
+		}
+		default:
+			return FMath::Abs(Local.X) <= Extent.X && FMath::Abs(Local.Y) <= Extent.Y && FMath::Abs(Local.Z) <= Extent.Z;
+		}
+	}
+
+	//True if a sphere touches the shape, used to find the bodies already inside a newly registered zone
+	FORCEINLINE bool IntersectsSphere(const FVector& SphereCenter, double Radius) const
+	{
+		const FVector Local = Rotation.UnrotateVector(SphereCenter - Center);
+		switch (Shape)
+		{
+		case EShape::Sphere:
+			return Local.SizeSquared() <= FMath::Square(Extent.X + Radius);
+		case EShape::Capsule:
+		{
+			const double SegmentHalfLength = FMath::Max(Extent.Z - Extent.X, 0.0);
+			const FVector Closest(0, 0, FMath::Clamp(Local.Z, -SegmentHalfLength, SegmentHalfLength));
+			return FVector::DistSquared(Local, Closest) <= FMath::Square(Extent.X + Radius);
+		}
+		default:
+			return FVector::DistSquared(Local, Local.BoundToBox(-Extent, Extent)) <= FMath::Square(Radius);
+		}
+	}
+
+	//World space bounding box of the shape
+	FBox GetBounds() const;
+};
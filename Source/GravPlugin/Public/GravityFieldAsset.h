@@ -0,0 +1,96 @@
+// --- GravityFieldAsset.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GravityField.h"
+#include "GravityFieldAsset.generated.h"
+
+class UStaticMesh;
+
+/**
+ * A point mass contributing to a baked field, in the asset's local space.
+ */
+USTRUCT(BlueprintType)
+struct FGravityPointMass
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Field")
+	FVector Location = FVector::ZeroVector;
+
+	//Mass in kg
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Field", meta = (ClampMin = "0"))
+	double Mass = 1.0;
+};
+
+/**
+ * Gravity field baked offline into a sparse bricked grid, sampled by zones with the BakedGrid field type.
+ * Zones hold a hard reference, so the grid streams in with the level that places them.
+ */
+UCLASS(BlueprintType)
+class GRAVPLUGIN_API UGravityFieldAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	//Half size of the baked region around the zone origin
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "1"))
+	FVector Extent = FVector(10000.0);
+
+	//Distance between samples, smaller values follow the field more closely at the cost of memory
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "1"))
+	float VoxelSize = 250.f;
+
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	EGravityFieldPrecision Precision = EGravityFieldPrecision::Quantized16;
+
+	//Bricks whose samples all lie within this distance of their mean, in cm/s^2, are stored as a single value
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "0"))
+	float ConstantBrickTolerance = 1.f;
+
+	//In cm^3 / (kg s^2), the physical value makes asteroid sized bodies very weak so scale it up for gameplay
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "0"))
+	double GravitationalConstant = 6.674e-5;
+
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	TArray<FGravityPointMass> PointMasses;
+
+	//Mesh whose simple collision is filled with point masses, placed at the zone origin
+	UPROPERTY(EditAnywhere, Category = "Bake")
+	TSoftObjectPtr<UStaticMesh> SourceMesh;
+
+	//Mass per cubic cm of the source mesh in kg
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "0"))
+	double MeshDensity = 1.0;
+
+	//Spacing of the point masses the source mesh is filled with
+	UPROPERTY(EditAnywhere, Category = "Bake", meta = (ClampMin = "1"))
+	float MeshSampleSpacing = 200.f;
+
+	//Baked samples as saved with the asset
+	UPROPERTY(VisibleAnywhere, Category = "Baked Data")
+	FGravityFieldGrid Grid;
+
+	//Baked samples zones evaluate, null until the asset has been baked. Field params and snapshots hold their own
+	//reference, so a snapshot still being sampled on a worker keeps the data alive after the asset is collected or rebaked
+	TSharedPtr<const FGravityFieldGrid, ESPMode::ThreadSafe> GetSharedGrid() const { return SharedGrid; }
+
+	//UObject Interface
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	//Rebuilds Grid from the point masses and source mesh
+	UFUNCTION(CallInEditor, Category = "Bake")
+	void Bake();
+
+private:
+	void AppendMeshPointMasses(TArray<FGravityPointMass>& OutPointMasses) const;
+#endif
+
+private:
+	void UpdateSharedGrid();
+
+	TSharedPtr<const FGravityFieldGrid, ESPMode::ThreadSafe> SharedGrid;
+};
@@ -0,0 +1,98 @@
+// --- GravityFieldSnapshot.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GravityField.h"
+
+/**
+ * Immutable copy of every registered zone's field, priority, damping and shape, published by the manager once per tick.
+ * Lets systems that are not actors sample the zones with the same priority rules from any thread. Zones whose gravity or
+ * damping is implemented in Blueprint cannot be called from here and contribute their BaseVector and damping properties.
+ * A flattened bounds hierarchy built with the snapshot keeps zone lookups logarithmic in the number of zones.
+ */
+struct GRAVPLUGIN_API FGravityFieldSnapshot
+{
+	struct FZone
+	{
+		FGravityFieldParams Field;
+		int32 Priority = 0;
+		float LinearDamping = 0.f;
+		float AngularDamping = 0.f;
+		FBox Bounds = FBox(ForceInit);
+		int32 FirstVolume = 0;
+		int32 NumVolumes = 0;
+	};
+
+	// Reusable working memory for SampleBatch, keep one per calling thread
+	struct FBatchScratch
+	{
+		TArray<int32> ZoneLaneCounts;
+		TArray<int32> ZoneLaneStarts;
+		TArray<int32> LaneEntities;
+		TArray<int32> EntityZones;
+		TArray<int32> EntityZoneCounts;
+		TArray<double> X, Y, Z, Priority, OutX, OutY, OutZ;
+		TArray<double> EntityPriority;
+	};
+
+	TArray<FZone> Zones;
+	TArray<FGravityZoneVolume> Volumes;
+
+	void Reset();
+
+	//Rebuilds the bounds hierarchy over Zones, called once the zones of a new snapshot have been filled in
+	void BuildBoundsHierarchy();
+
+	//True if a position lies inside any of the zone's shapes
+	bool ZoneContains(int32 ZoneIndex, const FVector& Position) const;
+
+	//Calls Func with the index of every zone containing Position, only testing zones whose bounds reach it
+	template<typename FuncType>
+	void ForEachZoneAt(const FVector& Position, FuncType&& Func) const
+	{
+		if (BoundsNodes.Num() == 0) return;
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+		while (Stack.Num() > 0)
+		{
+			const FBoundsNode& Node = BoundsNodes[Stack.Pop(EAllowShrinking::No)];
+			if (!Node.Bounds.IsInsideOrOn(Position)) continue;
+			if (Node.FirstChild != INDEX_NONE)
+			{
+				Stack.Add(Node.FirstChild);
+				Stack.Add(Node.FirstChild + 1);
+				continue;
+			}
+			for (int32 Slot = Node.FirstZone; Slot < Node.FirstZone + Node.NumZones; ++Slot)
+			{
+				if (ZoneContains(NodeZones[Slot], Position))
+				{
+					Func(NodeZones[Slot]);
+				}
+			}
+		}
+	}
+
+	//Net gravity and max damping for a batch of positions. Positions are grouped by zone and run through the
+	//same field kernels as the actor path, with GravKernel::ResolvePriorities masking every zone below a
+	//position's highest priority before the results are summed. Pass an empty OutDamping to skip damping
+	void SampleBatch(TConstArrayView<FVector> Positions, TArrayView<FVector> OutGravity, TArrayView<FVector2f> OutDamping, FBatchScratch& Scratch) const;
+
+private:
+	struct FBoundsNode
+	{
+		FBox Bounds = FBox(ForceInit);
+		int32 FirstChild = INDEX_NONE; //Both children are stored next to each other, INDEX_NONE for leaves
+		int32 FirstZone = 0;           //A range of NodeZones
+		int32 NumZones = 0;
+	};
+
+	static constexpr int32 MaxLeafZones = 4;
+
+	void BuildBoundsNode(int32 NodeIndex);
+
+	TArray<FBoundsNode> BoundsNodes;
+	TArray<int32> NodeZones;   //Zone indices, reordered so every node covers a contiguous range
+};
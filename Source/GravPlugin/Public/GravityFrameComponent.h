@@ -0,0 +1,70 @@
+// --- GravityFrameComponent.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GravityFrameComponent.generated.h"
+
+class UCharacterMovementComponent;
+
+/**
+ * Smoothed gravity direction and the basis that goes with it, shared by everything on a pawn that needs to know
+ * which way is down: the controller, the camera and the movement component. The direction follows the owner's
+ * movement component with a critically damped spring, so the blend takes the same time at any frame rate. The basis
+ * is carried along with the direction by the rotation applied each frame instead of being rebuilt from world down,
+ * which keeps yaw continuous when gravity flips and only costs quaternion work on frames where the direction moves.
+ */
+UCLASS(ClassGroup = (Gravity), meta = (BlueprintSpawnableComponent))
+class GRAVPLUGIN_API UGravityFrameComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGravityFrameComponent();
+
+	//Approximate seconds the direction takes to settle after gravity changes, 0 snaps
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Frame", meta = (ClampMin = "0"))
+	float SmoothingTime;
+
+	//Only smooth while the owner is falling, grounded characters follow gravity directly since walking only turns it gradually
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Frame")
+	bool bOnlyBlendWhileFalling;
+
+	//Moves the frame towards the movement component's gravity. Runs once per frame no matter how many users call it
+	void Advance(float DeltaTime);
+
+	//Jumps straight to a direction, resetting the basis and any blend in progress
+	UFUNCTION(BlueprintCallable, Category = "Gravity Frame")
+	void SnapToDirection(FVector Direction);
+
+	UFUNCTION(BlueprintPure, Category = "Gravity Frame")
+	FVector GetGravityDirection() const { return Direction; }
+
+	//Rotation taking world down onto the smoothed gravity direction
+	UFUNCTION(BlueprintPure, Category = "Gravity Frame")
+	FQuat GetGravityToWorld() const { return GravityToWorld; }
+
+	//Rotation applied to the basis by the last Advance, identity while gravity is steady
+	const FQuat& GetFrameDelta() const { return FrameDelta; }
+
+	UFUNCTION(BlueprintPure, Category = "Gravity Frame")
+	FRotator ToGravityRelative(FRotator WorldRotation) const { return (GravityToWorld.Inverse() * WorldRotation.Quaternion()).Rotator(); }
+
+	UFUNCTION(BlueprintPure, Category = "Gravity Frame")
+	FRotator ToWorld(FRotator RelativeRotation) const { return (GravityToWorld * RelativeRotation.Quaternion()).Rotator(); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UCharacterMovementComponent> MovementComp;
+
+	FVector Direction = FVector::DownVector;
+	FQuat GravityToWorld = FQuat::Identity;
+	FQuat FrameDelta = FQuat::Identity;
+	double AngularSpeed = 0.0; //Radians per second the direction is closing on the target
+	uint64 LastAdvanceFrame = MAX_uint64;
+};
@@ -4,18 +4,152 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "GravityField.h"
+#include "GravityBarnesHut.h"
+#include "GravityFieldSnapshot.h"
+#include "GravityTrajectory.h"
+#include "Tasks/Task.h"
+#include "Math/GenericOctree.h"
+#include "Components/SceneComponent.h"
+#include <atomic>
 #include "GravityManager.generated.h"
 
 class AGravityZone;
 class UPrimitiveComponent;
+class UCharacterMovementComponent;
+class USkeletalMeshComponent;
+class APawn;
+class UGravitySourceComponent;
+class AGravityReplicationProxy;
+class UActorComponent;
 class AActor;
+struct FBodyInstance;
+class FGravitySimCallback;
+class FSingleParticlePhysicsProxy;
+struct FGravityZoneSet;
+
+/**
+ * Identifies a zone slot in the manager's registry. The generation is bumped whenever the slot is
+ * released, so handles held by a zone that has since been unregistered are detected as stale.
+ */
+struct FGravityZoneHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+};
+
+/**
+ * Zone entry in the manager's octree, bounds enclose every volume of the zone.
+ */
+struct FGravityZoneOctreeElement
+{
+	AGravityZone* Zone = nullptr;
+	int32 ZoneIndex = INDEX_NONE;
+	FBoxCenterAndExtent Bounds;
+};
+
+struct FGravityZoneOctreeSemantics
+{
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FGravityZoneOctreeElement& Element) { return Element.Bounds; }
+	FORCEINLINE static bool AreElementsEqual(const FGravityZoneOctreeElement& A, const FGravityZoneOctreeElement& B) { return A.ZoneIndex == B.ZoneIndex; }
+	static void SetElementId(const FGravityZoneOctreeElement& Element, FOctreeElementId2 Id);
+};
+
+typedef TOctree2<FGravityZoneOctreeElement, FGravityZoneOctreeSemantics> FGravityZoneOctree;
+
+/**
+ * How often an actor is processed by the manager.
+ */
+UENUM(BlueprintType)
+enum class EGravityUpdateTier : uint8
+{
+	Full     UMETA(ToolTip = "Processed every tick"),
+	Reduced  UMETA(ToolTip = "Processed every ReducedRateInterval ticks with the skipped time accumulated"),
+	Asleep   UMETA(ToolTip = "Every simulating body is asleep, skipped until physics wakes one")
+};
+
+/**
+ * Rules used to place actors into update tiers each tick.
+ */
+USTRUCT(BlueprintType)
+struct FGravityUpdateTierPolicy
+{
+	GENERATED_BODY()
+
+	//Actors further than this from every player view point drop to the reduced tier, 0 keeps everyone at full rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Tiers", meta = (ClampMin = "0"))
+	float ReducedRateDistance = 10000.f;
+
+	//Ticks between updates in the reduced tier, ignored in physics substep mode where bodies are driven every step anyway
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Tiers", meta = (ClampMin = "1"))
+	int32 ReducedRateInterval = 4;
+
+	//Skip actors whose simulating bodies are all asleep
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Tiers")
+	bool bSkipSleepingBodies = true;
+
+	//Actors with this tag always run at full rate, as do player controlled pawns and actors passed to SetActorSignificant
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Tiers")
+	FName SignificantTag = TEXT("GravitySignificant");
+};
+
+/**
+ * Number of actors that landed in each tier on the last tick.
+ */
+USTRUCT(BlueprintType)
+struct FGravityTierCounts
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Tiers")
+	int32 Full = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Tiers")
+	int32 Reduced = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Tiers")
+	int32 Asleep = 0;
+};
+
+/**
+ * Work done by the manager on the last tick, mirrors the stat gravity counters for builds without stats.
+ */
+USTRUCT(BlueprintType)
+struct FGravityTickStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Stats")
+	int32 ActorsProcessed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Stats")
+	int32 ZoneEvaluations = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Stats")
+	int32 BlueprintEvaluations = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Stats")
+	int32 BodiesTouched = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Stats")
+	int32 ActorsInGravityGroups = 0;
+};
 
 /**
  * UWorldSubsystem that manages custom gravity zones and applies gravity to affected objects.
  * Functions are exposed to Blueprint for easier interaction.
  */
 UCLASS(Blueprintable)
-class UGravityManager : public UTickableWorldSubsystem
+class GRAVPLUGIN_API UGravityManager : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -26,6 +160,24 @@ public:
 
 	bool UseGravity = true; //Can toggle to disable gravity feature
 	bool UseDampen = true;  //Can toggle to disable dampen feature
+	bool UseParallelTick = true; //Can toggle to run the compute phase of the tick serially on the game thread
+	int32 ParallelTickMinBatchSize = 64; //Minimum number of actors handed to each worker during the compute phase
+	int32 FieldKernelChunkSize = 1024; //Maximum number of positions one worker evaluates against a single zone
+	bool UsePhysicsSubstep = false; //Apply body gravity as an acceleration on the physics thread before every substep instead of once per frame
+	bool UseNBody = true; //Can toggle to disable gravity from UGravitySourceComponents
+	double NBodyTheta = 0.5; //Barnes-Hut opening angle, 0 is an exact sum and larger values trade accuracy for speed
+	int32 NBodyPriority = 0; //Zone priority the combined source field competes at, like a zone covering the whole world
+	double NBodyGravitationalConstant = 6.674e-5; //In cm^3 / (kg s^2)
+	double NBodySoftening = 100.0; //Keeps the pull finite when two sources pass through each other
+	bool UseReplication = false; //Server resolves gravity for replicated actors and clients apply it instead of evaluating zones
+	int32 TrajectoryChunkSize = 32; //Number of trajectories one worker steps together during prediction
+	bool UseDeferredZoneRegistration = true; //Zones registered during play find the actors already inside them in batched passes spread over later ticks
+	int32 ZoneOnboardingBatchSize = 64; //Maximum number of new zones covered by one broadphase query
+	float ZoneOnboardingBudgetMs = 1.f; //Game thread time per tick spent adding the overlaps found for new zones
+	bool UseGravityGroups = true; //Bodies whose gravity only comes from uniform zones are moved into a Chaos gravity group and integrated by the solver
+	double GravityGroupTolerance = 0.1; //Gravity vectors closer than this share a group
+
+	static constexpr int32 MaxGravityGroups = 8; //Gravity groups kept by the Chaos solver, group 0 is the world's own gravity
 
 	// --- Gravity Zone Management ---
 	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
@@ -34,6 +186,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
 	void UnregisterGravityZone(AGravityZone* GravityZone);
 
+	//Re-resolves the active zones of every actor inside, called by AGravityZone::SetPriority
+	void NotifyZonePriorityChanged(AGravityZone* GravityZone);
+
+	//Refreshes the zone's position query shapes on the next tick. Moving the zone or its shapes is picked up on its own,
+	//call this after resizing a shape at runtime (SetSphereRadius, SetBoxExtent, SetCapsuleSize) or adding or removing one
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void MarkZoneVolumesDirty(AGravityZone* GravityZone);
+
+	//Replaces the zone's exclusion mask, dropping actors that are now excluded and picking up overlapping ones that no longer are.
+	//Called by AGravityZone::SetExclusionTags
+	void NotifyZoneExclusionTagsChanged(AGravityZone* GravityZone, TConstArrayView<FName> ExclusionTags);
+
+	//Re-resolves the actor's tag mask after its Tags changed at runtime
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void NotifyActorTagsChanged(AActor* AffectedActor);
+
+	// --- Gravity Source Management ---
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void RegisterGravitySource(UGravitySourceComponent* GravitySource);
+
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void UnregisterGravitySource(UGravitySourceComponent* GravitySource);
+
 	// --- Object Overlap Notification ---
 	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
 	void NotifyObjectEnteredZone(AActor* AffectedActor, AGravityZone* GravityZone);
@@ -41,6 +216,62 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
 	void NotifyObjectLeftZone(AActor* AffectedActor, AGravityZone* GravityZone);
 
+	// --- Update Tiers ---
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Manager")
+	FGravityUpdateTierPolicy TierPolicy;
+
+	//Keeps an actor in the full rate tier regardless of distance
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void SetActorSignificant(AActor* AffectedActor, bool bSignificant);
+
+	UFUNCTION(BlueprintPure, Category = "Gravity Manager")
+	FGravityTierCounts GetTierCounts() const { return TierCounts; }
+
+	UFUNCTION(BlueprintPure, Category = "Gravity Manager")
+	FGravityTickStats GetLastTickStats() const { return TickStats; }
+
+	// --- Position Query Membership ---
+	//Resolves the actor's zones from its location every tick instead of from overlap notifications
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void RegisterPositionQueryActor(AActor* AffectedActor);
+
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager")
+	void UnregisterPositionQueryActor(AActor* AffectedActor);
+
+	// --- Replication ---
+	void SetReplicationProxy(AGravityReplicationProxy* Proxy);
+	void ApplyReplicatedGravity(AActor* AffectedActor, const FVector& Gravity);
+	void ClearReplicatedGravity(AActor* AffectedActor);
+
+	// --- Gravity Sources ---
+	//True when sources compete with zones this tick
+	bool HasActiveGravitySources() const { return UseGravity && UseNBody && !SourceTree.IsEmpty(); }
+
+	//Pull of every source except those owned by ExcludeOwner, as of the last tick. Game thread only
+	FVector SampleGravitySources(const FVector& Position, AActor* ExcludeOwner) const;
+
+	// --- Field Snapshot ---
+	//Zone fields as of the last tick for sampling outside the actor path. Lock free and safe from any thread, the returned copy stays valid while held
+	TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> GetFieldSnapshot() const;
+
+	//Net zone gravity at each position with the same priority rules as actors, against the last published snapshot. Lock free and
+	//safe from any thread. Gravity sources are not included and Blueprint implemented zones contribute their BaseVector
+	void SampleGravity(TConstArrayView<FVector> Positions, TArrayView<FVector> OutGravity) const;
+
+	// --- Trajectory Prediction ---
+	//Integrates every start state through the zones of the last tick on worker threads. Gravity sources are not included.
+	//Reusing OutBuffer between calls of the same size keeps prediction allocation free
+	void PredictTrajectories(TConstArrayView<FGravityTrajectoryStart> Starts, const FGravityTrajectoryParams& Params, FGravityTrajectoryBuffer& OutBuffer) const;
+
+	//Same as PredictTrajectories without blocking the game thread, OnPredicted is called on the game thread unless the manager is gone by then
+	void PredictTrajectoriesAsync(TArray<FGravityTrajectoryStart> Starts, const FGravityTrajectoryParams& Params, TUniqueFunction<void(const FGravityTrajectoryBuffer&)> OnPredicted);
+
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager", meta = (DisplayName = "Predict Trajectories"))
+	void K2_PredictTrajectories(const TArray<FGravityTrajectoryStart>& Starts, const FGravityTrajectoryParams& Params, TArray<FGravityTrajectory>& OutTrajectories) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Gravity Manager", meta = (DisplayName = "Predict Trajectories Async"))
+	void K2_PredictTrajectoriesAsync(const TArray<FGravityTrajectoryStart>& Starts, const FGravityTrajectoryParams& Params, FGravityTrajectoriesPredicted OnPredicted);
+
 	// --- Tick Function ---
 	virtual void Tick(float DeltaTime) override;
 	virtual TStatId GetStatId() const override;
@@ -53,12 +284,273 @@ public:
 
 private:
 	// --- Internal Data Structures ---
-	TSet<AGravityZone*> RegisteredGravityZones;
-	TMap<AActor*, TSet<AGravityZone*>> ActorZoneOverlaps;
+	// Zone slots are stable while registered and recycled through a free list
+	struct FZoneSlot
+	{
+		AGravityZone* Zone = nullptr;
+		uint32 Generation = 0;
+		TArray<int32> Actors; //Actor slots overlapping this zone
+		int32 Priority = 0;   //Priority the actors' active zones were resolved with
+		uint64 ExclusionMask = 0; //Bits of the zone's ExclusionTags, actors whose TagMask shares a bit are excluded
+
+		//Analytic shapes used for position queries, refreshed when the zone or one of its overlap shapes moves
+		TArray<FGravityZoneVolume, TInlineAllocator<1>> Volumes;
+		bool bVolumesDirty = true;
+		TArray<TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>, TInlineAllocator<2>> TransformBindings;
+	};
+
+	// A physics body driven by the manager, with the damping it had before and the damping last written to it
+	struct FBodyTarget
+	{
+		FBodyInstance* Body = nullptr;
+		FVector2f OriginalDamping = FVector2f::ZeroVector; //Linear, angular
+		FVector2f AppliedDamping = FVector2f::ZeroVector;
+		bool bDampingApplied = false;
+		FSingleParticlePhysicsProxy* GroupedHandle = nullptr; //Particle moved into the actor's gravity group
+	};
+
+	// Actor slots are kept dense, removal swaps the last slot into the hole
+	struct FActorSlot
+	{
+		AActor* Actor = nullptr;
+		TArray<int32, TInlineAllocator<4>> Zones; //Zone slots this actor overlaps, in the order they were entered
+		TArray<int32, TInlineAllocator<2>> ActiveZones; //The subset of Zones at the highest priority, gravity is only sampled from these
+		int32 ActivePriority = -INT_MAX;
+		uint64 TagMask = 0;                       //Bits of the actor's Tags that some zone excludes
+		bool bQueryByPosition = false;            //Zones come from ResolvePositionQueries, overlap notifications are ignored
+		bool bSignificant = false;                //Pinned to the full rate tier
+		bool bOwnsGravitySource = false;          //Kept registered without zones so the other sources can pull it
+		bool bIgnoreGravitySources = false;       //Owns a source that is not pulled by the others
+		bool bReplicatedGravity = false;          //Client only, gravity comes from the server instead of zones
+		FVector ReplicatedGravity = FVector::ZeroVector;
+		float AccumulatedTime = 0.f;              //Time since the actor was last processed
+		TSharedPtr<FGravityZoneSet> ZoneSet;      //Set sampled by a gravity movement component, the tick skips the actor unless it ragdolls
+		int32 GravityGroup = INDEX_NONE;          //Gravity group the bodies were moved into, the force path skips the actor while set
+		bool bGravityGroupDirty = false;          //Bodies were rebuilt since the group was assigned
+
+		//Physics targets resolved when the actor enters, rebuilt after any of its components create or destroy physics state
+		bool bTargetsDirty = true;
+		bool bIsCharacter = false;
+		bool bHasSignificantTag = false;
+		APawn* Pawn = nullptr;
+		UCharacterMovementComponent* MovementComp = nullptr;
+		USkeletalMeshComponent* CharacterMesh = nullptr;
+		FBodyTarget RootTarget; //Character capsule
+		TArray<FBodyTarget, TInlineAllocator<1>> Bodies; //Ragdoll bodies for characters, component bodies otherwise
+	};
+
+	TArray<FZoneSlot> ZoneSlots;
+	TArray<int32> FreeZoneSlots;
+	TArray<FActorSlot> ActorSlots;
+	TMap<AActor*, int32> ActorSlotIndices;
+	FGravityZoneOctree ZoneOctree { FVector::ZeroVector, HALF_WORLD_MAX };
+
+	// --- Exclusion Masks ---
+	// Every tag named by a zone's ExclusionTags gets a bit, so exclusion is a single AND of the zone and actor masks.
+	// Tags past the 63rd share the last bit, which can exclude actors that only match another overflowed tag
+	uint64 ResolveExclusionMask(TConstArrayView<FName> ExclusionTags);
+	uint64 ResolveTagMask(const AActor* AffectedActor) const;
+	uint64 GetActorTagMask(const AActor* AffectedActor) const;
+	TMap<FName, int32> ExclusionTagBits;
+
+	// --- Registry Helpers ---
+	int32 FindZoneSlot(const AGravityZone* GravityZone) const;
+	int32 FindOrAddZoneSlot(AGravityZone* GravityZone);
+	void ReleaseZoneSlot(int32 ZoneIndex);
+	int32 FindOrAddActorSlot(AActor* AffectedActor);
+	void RemoveActorSlot(int32 ActorIndex);
+	bool CanReleaseActorSlot(const FActorSlot& ActorSlot) const;
+	void ReleaseZonelessActors();
+	bool IsActorExcluded(uint64 TagMask, int32 ZoneIndex) const { return (TagMask & ZoneSlots[ZoneIndex].ExclusionMask) != 0; }
+	bool CanBeAffected(AActor* AffectedActor) const;
+	void AddOverlap(int32 ActorIndex, int32 ZoneIndex);
+	void RemoveOverlap(int32 ActorIndex, int32 ZoneIndex);
+	void ResolveActiveZones(FActorSlot& ActorSlot);
+	void SyncZoneSet(const FActorSlot& ActorSlot);
+	void OnZonePriorityChanged(int32 ZoneIndex);
+
+	// --- Zone Volumes ---
+	void BindZoneTransforms(FZoneSlot& ZoneSlot);
+	void UnbindZoneTransforms(FZoneSlot& ZoneSlot);
+	void OnZoneTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+	void UpdateZoneVolumes();
+	void ResolvePositionQueries();
+	TArray<int32, TInlineAllocator<8>> QueryZones;
+
+	// --- Physics Target Cache ---
+	void RefreshActorTargets(FActorSlot& ActorSlot);
+	void OnComponentPhysicsStateChanged(UActorComponent* Component);
+	void ApplyBodyDamping(FBodyTarget& Target, const FVector2f& Damping);
+	void RestoreActorDamping(FActorSlot& ActorSlot);
+	FDelegateHandle PhysicsCreatedHandle;
+	FDelegateHandle PhysicsDestroyedHandle;
+
+	// --- Tick Snapshot Data ---
+	// Zone parameters captured once per tick on the game thread, indexed like ZoneSlots
+	struct FZoneSnapshot
+	{
+		AGravityZone* Zone = nullptr;
+		int32 Priority = 0;
+		FGravityFieldParams Field;
+		double LinearDamping = 0.0;
+		double AngularDamping = 0.0;
+		bool bCustomGravity = false;   //Custom field type, GetGravityVector is sampled on the game thread during gather
+		bool bCustomDampening = false; //GetLinear/AngularDampening are overridden, sampled on the game thread during gather
+		int32 BatchStart = 0;          //Range of this zone's lanes in the structure-of-arrays batch
+		int32 BatchNum = 0;
+	};
+
+	// One actor/zone pair, stored contiguously per actor in the order the zones were visited
+	struct FZoneSample
+	{
+		int32 ZoneIndex = INDEX_NONE;
+		FVector Gravity = FVector::ZeroVector;
+		double LinearDamping = 0.0;
+		double AngularDamping = 0.0;
+	};
+
+	// Read-only actor state captured during gather plus the results written by the compute phase, indexed like ActorSlots
+	struct FActorSnapshot
+	{
+		AActor* Actor = nullptr;
+		FVector Location = FVector::ZeroVector;
+		bool bIsCharacterGrounded = false;
+		bool bSkip = false;           //Asleep, or a reduced tier actor waiting for its turn
+		float GravityTimeScale = 1.f; //Time since the actor was last applied over this tick's, scales the force so skipped frames are made up
+		int32 HighestPriority = 0;
+		int32 FirstGravitySample = 0; //Samples from the highest priority zones only
+		int32 NumGravitySamples = 0;
+		int32 FirstDampingSample = 0; //Samples from every overlapping zone
+		int32 NumDampingSamples = 0;
+		bool bSampleNBody = false;    //Gravity sources compete at the highest priority
+		bool bReplicatedGravity = false; //NetGravity was filled from the server's value
+		FVector NBodyGravity = FVector::ZeroVector;
+		FVector NetGravity = FVector::ZeroVector;
+		FVector MaxDamping = FVector::ZeroVector;
+	};
+
+	// Slice of one zone's batch handed to a single worker
+	struct FBatchChunk
+	{
+		int32 ZoneIndex = INDEX_NONE;
+		int32 Start = 0;
+		int32 Num = 0;
+	};
+
+	// Scratch buffers reused between ticks so the steady state does not allocate
+	TArray<FZoneSnapshot> ZoneSnapshots;
+	TArray<FZoneSample> GravitySamples;
+	TArray<FZoneSample> DampingSamples;
+	TArray<FActorSnapshot> ActorSnapshots;
+
+	// Actor positions grouped by zone as structure-of-arrays for the native field kernels
+	TArray<double> BatchX;
+	TArray<double> BatchY;
+	TArray<double> BatchZ;
+	TArray<double> BatchOutX;
+	TArray<double> BatchOutY;
+	TArray<double> BatchOutZ;
+	TArray<int32> BatchSampleIndices;
+	TArray<FBatchChunk> BatchChunks;
+
+	// --- Replication ---
+	void PublishReplicatedGravity();
+	TWeakObjectPtr<AGravityReplicationProxy> ReplicationProxy;
+
+	// --- Field Snapshot ---
+	// Published snapshots alternate between two slots. Readers pin the published slot through its counter while they copy it,
+	// so the game thread only refills the other slot and neither side takes a lock
+	void PublishFieldSnapshot();
+	TSharedPtr<FGravityFieldSnapshot, ESPMode::ThreadSafe> FieldSnapshots[2];
+	std::atomic<int32> PublishedFieldSnapshot { 0 };
+	mutable std::atomic<int32> FieldSnapshotReaders[2] { 0, 0 };
+
+	// --- Zone Onboarding ---
+	// Plain copies of the zones in a batch and the bodies the broadphase found around them, read by the overlap task
+	struct FOnboardingZone
+	{
+		FGravityZoneHandle Handle;
+		ECollisionChannel ObjectType = ECC_WorldDynamic;
+		FCollisionResponseContainer Responses;
+		TArray<FGravityZoneVolume, TInlineAllocator<1>> Volumes;
+		FBox Bounds = FBox(ForceInit);
+	};
+
+	struct FOnboardingCandidate
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Center = FVector::ZeroVector;
+		double Radius = 0.0;
+		ECollisionChannel ObjectType = ECC_WorldDynamic;
+		FCollisionResponseContainer Responses;
+	};
+
+	struct FZoneOnboarding
+	{
+		TArray<FOnboardingZone> Zones;
+		TArray<FOnboardingCandidate> Candidates;
+		TArray<TPair<int32, int32>> Overlaps; //Candidate and zone, grouped by candidate
+		int32 NextOverlap = 0;                //Overlaps before this were added on earlier ticks
+	};
+
+	void OnboardPendingZones();
+	void StartZoneOnboarding();
+	TArray<FGravityZoneHandle> PendingZones;
+	TSharedPtr<FZoneOnboarding, ESPMode::ThreadSafe> ZoneOnboarding;
+	UE::Tasks::FTask ZoneOnboardingTask;
+
+	// --- Gravity Groups ---
+	// Uniform fields are handed to the solver as per particle gravity groups keyed by vector, so bodies in them are only
+	// touched when their resolved gravity changes instead of receiving a force every tick
+	struct FGravityGroup
+	{
+		FVector Gravity = FVector::ZeroVector;
+		int32 NumActors = 0;
+	};
+
+	void UpdateGravityGroups();
+	bool CanUseGravityGroup(const FActorSlot& ActorSlot, const FActorSnapshot& Snapshot) const;
+	int32 AcquireGravityGroup(const FVector& Gravity);
+	void AssignGravityGroup(FActorSlot& ActorSlot, int32 Group);
+	void ReleaseGravityGroup(FActorSlot& ActorSlot, bool bRestoreBodies);
+	FGravityGroup GravityGroups[MaxGravityGroups];
+
+	// --- Trajectory Prediction ---
+	TArray<UE::Tasks::FTask> TrajectoryTasks; //In flight async predictions, waited on before the world goes away
+
+	// --- Gravity Sources ---
+	void BuildSourceTree();
+	TArray<UGravitySourceComponent*> GravitySources;
+	TArray<FVector> SourcePositions;
+	TArray<double> SourceMasses;
+	TArray<int32> SourceKeys; //Actor slot of each source's owner, so actors never attract themselves
+	FGravityBarnesHutTree SourceTree;
+
+	// --- Update Tiers ---
+	EGravityUpdateTier ResolveUpdateTier(const FActorSlot& ActorSlot, const FVector& Location) const;
+	TSet<const AActor*> SignificantActors;
+	TArray<FVector, TInlineAllocator<4>> PlayerViewLocations;
+	FGravityTierCounts TierCounts;
+	uint32 TickCounter = 0;
+
+	// --- Tick Phases ---
+	FGravityTickStats TickStats;
+	void GatherTickData(float DeltaTime);
+	void ResolveZonePriorities();
+	void ComputeTickData();
+	void ApplyTickData();
+	void BuildZoneBatches();
+	void EvaluateZoneBatches();
+
+	// --- Physics Substep Mode ---
+	FGravitySimCallback* SimCallback = nullptr;
+	void UpdateSimCallback();
+	void UnregisterSimCallback();
+	void PushSimCallbackInput();
 
 	// --- Gravity Application Logic ---
-	FVector CalculateNetGravityVectorForActor(AActor* AffectedActor) const;
-	FVector CalculateMaxDampingVectorForActor(AActor* AffectedActor) const;
-	void ApplyDampingToActorComponents(AActor* AffectedActor, const FVector& DampingVector);
-	void ApplyGravityToActorComponents(AActor* AffectedActor, const FVector& NetGravityVector);
+	FVector CalculateNetGravityVectorForActor(const FActorSnapshot& Snapshot) const;
+	FVector CalculateMaxDampingVectorForActor(const FActorSnapshot& Snapshot) const;
+	void ApplyGravityToActor(FActorSlot& ActorSlot, const FActorSnapshot& Snapshot);
+	void ApplyDampingToActor(FActorSlot& ActorSlot, const FActorSnapshot& Snapshot);
 };
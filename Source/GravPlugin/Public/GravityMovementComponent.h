@@ -0,0 +1,91 @@
+// --- GravityMovementComponent.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GravityField.h"
+#include "GravityMovementComponent.generated.h"
+
+class AGravityZone;
+class UGravityFrameComponent;
+class UGravityManager;
+
+/**
+ * Zones a gravity movement component samples, kept current by the manager whenever the character enters or leaves a
+ * zone, priorities change or replicated gravity arrives. Shared between the manager's actor slot and the component.
+ */
+struct GRAVPLUGIN_API FGravityZoneSet
+{
+	TArray<TWeakObjectPtr<AGravityZone>, TInlineAllocator<2>> Zones; //Highest priority zones the character is inside
+	int32 Priority = -INT_MAX;                                       //Priority of Zones
+	bool bTracked = false;              //The manager holds a slot for the character, untracked characters use world gravity
+	bool bIgnoreGravitySources = false; //Owns a gravity source that is not pulled by the others
+	bool bReplicatedGravity = false;    //Client only, the server's value replaces the zones
+	FVector ReplicatedGravity = FVector::ZeroVector;
+
+	void Reset() { *this = FGravityZoneSet(); }
+};
+
+/**
+ * Character movement that takes gravity straight from its zones instead of being driven by the manager's tick. The zone
+ * fields are captured once per frame together with the gravity basis, and falling re-samples them at the start of every
+ * simulation iteration, so long frames still follow the curve of small planets. The manager only keeps the zone set
+ * current and skips these characters in its tick unless they ragdoll. With a gravity frame on the owner, the capsule
+ * is oriented by the frame's smoothed basis, the same one the controller and camera use, while the acceleration keeps
+ * the exact zone gravity.
+ */
+UCLASS(ClassGroup = (Gravity), meta = (BlueprintSpawnableComponent))
+class GRAVPLUGIN_API UGravityMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGravityMovementComponent();
+
+	//Re-sample the zones at the start of every falling iteration, otherwise gravity is held for the whole frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Character Movement: Gravity")
+	bool bSampleGravityPerIteration;
+
+	//Gravity at a position with the manager's priority rules, using this frame's zone fields
+	UFUNCTION(BlueprintPure, Category = "Character Movement: Gravity")
+	FVector SampleZoneGravity(const FVector& Position) const;
+
+	//Gravity captured at the start of this frame's movement
+	UFUNCTION(BlueprintPure, Category = "Character Movement: Gravity")
+	FVector GetFrameGravity() const { return FrameGravity; }
+
+	//True while gravity comes from zones rather than the world
+	UFUNCTION(BlueprintPure, Category = "Character Movement: Gravity")
+	bool HasZoneGravity() const { return bZoneGravity; }
+
+	const TSharedPtr<FGravityZoneSet>& GetZoneSet() const { return ZoneSet; }
+
+	//Frame the capsule orientation follows, found on the owner at BeginPlay or handed over by the controller
+	void SetGravityFrame(UGravityFrameComponent* InGravityFrame);
+
+	virtual float GetGravityZ() const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void PhysFalling(float DeltaTime, int32 Iterations) override;
+
+private:
+	void RefreshZoneFields();
+	void SetZoneGravity(const FVector& Gravity);
+	void ApplyGravityFrame();
+
+	TSharedPtr<FGravityZoneSet> ZoneSet;
+	TWeakObjectPtr<UGravityManager> Manager;
+	TWeakObjectPtr<UGravityFrameComponent> GravityFrame;
+
+	//Captured once per frame from ZoneSet, samples during the frame only evaluate these
+	TArray<FGravityFieldParams, TInlineAllocator<2>> ZoneFields;
+	TArray<TWeakObjectPtr<AGravityZone>, TInlineAllocator<1>> CustomZones; //Blueprint zones, called on the game thread
+	bool bZoneGravity = false;
+	bool bSampleZones = false;
+	bool bSampleSources = false;
+	double ZoneGravitySize = 0.0;
+	FVector FrameGravity = FVector::ZeroVector;
+};
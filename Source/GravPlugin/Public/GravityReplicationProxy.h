@@ -0,0 +1,102 @@
+// --- GravityReplicationProxy.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "GravityReplicationProxy.generated.h"
+
+class AGravityZone;
+class AGravityReplicationProxy;
+struct FGravityReplicatedArray;
+
+/**
+ * Server resolved gravity for one replicated actor, packed into six bytes plus the actor and zone references.
+ */
+USTRUCT()
+struct FGravityReplicatedItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Actor;
+
+	//Highest priority zone the server resolved, null when the gravity came from sources alone
+	UPROPERTY()
+	TObjectPtr<AGravityZone> Zone;
+
+	//Octahedral direction, 16 bits per axis
+	UPROPERTY()
+	uint32 PackedDirection = 0;
+
+	//Half precision magnitude in cm/s^2
+	UPROPERTY()
+	uint16 PackedMagnitude = 0;
+
+	FVector GetGravity() const;
+
+	//Returns false when the packed value is unchanged, so callers only dirty items that actually moved
+	bool SetGravity(const FVector& Gravity);
+
+	void PostReplicatedAdd(const FGravityReplicatedArray& InArraySerializer);
+	void PostReplicatedChange(const FGravityReplicatedArray& InArraySerializer);
+	void PreReplicatedRemove(const FGravityReplicatedArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FGravityReplicatedArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FGravityReplicatedItem> Items;
+
+	//Receives the client side callbacks
+	AGravityReplicationProxy* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FGravityReplicatedItem, FGravityReplicatedArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGravityReplicatedArray> : public TStructOpsTypeTraitsBase2<FGravityReplicatedArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Always relevant actor the server's gravity manager spawns when UseReplication is on. Carries the resolved gravity of
+ * every replicated actor the manager tracks, clients apply it instead of evaluating zones for those actors.
+ */
+UCLASS(NotPlaceable, Transient)
+class GRAVPLUGIN_API AGravityReplicationProxy : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	AGravityReplicationProxy();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// --- Server ---
+	void UpdateActor(AActor* AffectedActor, const FVector& Gravity, AGravityZone* Zone);
+	void RemoveActor(AActor* AffectedActor);
+
+	// --- Client ---
+	void OnItemReplicated(const FGravityReplicatedItem& Item);
+	void OnItemRemoved(const FGravityReplicatedItem& Item);
+
+private:
+	UPROPERTY(Replicated)
+	FGravityReplicatedArray Replicated;
+
+	TMap<AActor*, int32> ItemIndices;
+};
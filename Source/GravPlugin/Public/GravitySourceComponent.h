@@ -0,0 +1,32 @@
+// --- GravitySourceComponent.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "GravitySourceComponent.generated.h"
+
+/**
+ * A moving point mass that attracts every actor the gravity manager tracks, including the owners of other sources.
+ * Sources are gathered into a Barnes-Hut octree each tick and contribute like a world wide zone at the manager's NBodyPriority.
+ */
+UCLASS(ClassGroup = (Gravity), meta = (BlueprintSpawnableComponent))
+class GRAVPLUGIN_API UGravitySourceComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGravitySourceComponent();
+
+	//Mass in kg, scaled by the manager's NBodyGravitationalConstant
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Source", meta = (ClampMin = "0"))
+	double Mass;
+
+	//Whether the owner is pulled by the other sources, turn off for anchored bodies like a sun
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Source")
+	bool bAffectedByOtherSources;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,39 @@
+// --- GravityStats.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+GRAVPLUGIN_API DECLARE_LOG_CATEGORY_EXTERN(LogGravity, Log, All);
+
+// Enable with -trace=cpu,gravity to capture the manager phases in Unreal Insights
+UE_TRACE_CHANNEL_EXTERN(GravityChannel, GRAVPLUGIN_API);
+
+// --- stat gravity ---
+DECLARE_STATS_GROUP(TEXT("Gravity"), STATGROUP_Gravity, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gather"), STAT_GravityGather, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Priority Resolution"), STAT_GravityPriorityResolution, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("N-Body Build"), STAT_GravityNBodyBuild, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Zone Evaluation"), STAT_GravityZoneEvaluation, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gravity Apply"), STAT_GravityApplyGravity, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damping Apply"), STAT_GravityApplyDamping, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Trajectory Prediction"), STAT_GravityTrajectories, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Zone Onboarding"), STAT_GravityZoneOnboarding, STATGROUP_Gravity, GRAVPLUGIN_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors Processed"), STAT_GravityActorsProcessed, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Zone Evaluations"), STAT_GravityZoneEvaluations, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Blueprint Evaluations"), STAT_GravityBlueprintEvaluations, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bodies Touched"), STAT_GravityBodiesTouched, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors Full Rate"), STAT_GravityActorsFull, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors Reduced Rate"), STAT_GravityActorsReduced, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors Asleep"), STAT_GravityActorsAsleep, STATGROUP_Gravity, GRAVPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors In Gravity Groups"), STAT_GravityActorsGrouped, STATGROUP_Gravity, GRAVPLUGIN_API);
+
+// Cycle counter for stat gravity plus a matching Insights scope on the gravity channel
+#define GRAVITY_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, GravityChannel)
@@ -0,0 +1,143 @@
+// --- GravityTrajectory.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "GravityTrajectory.generated.h"
+
+struct FGravityFieldSnapshot;
+class UWorld;
+
+/**
+ * Integration scheme used to step trajectories through the zone field.
+ */
+UENUM(BlueprintType)
+enum class EGravityTrajectoryIntegrator : uint8
+{
+	SemiImplicitEuler UMETA(ToolTip = "One field sample per step, matches how the physics solver integrates bodies"),
+	RK4               UMETA(ToolTip = "Four field samples per step, stays on curved arcs with much larger time steps")
+};
+
+/**
+ * Initial state of one predicted trajectory.
+ */
+USTRUCT(BlueprintType)
+struct FGravityTrajectoryStart
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory")
+	FVector Position = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory")
+	FVector Velocity = FVector::ZeroVector;
+};
+
+/**
+ * Settings shared by every trajectory in one prediction request.
+ */
+USTRUCT(BlueprintType)
+struct FGravityTrajectoryParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory")
+	EGravityTrajectoryIntegrator Integrator = EGravityTrajectoryIntegrator::SemiImplicitEuler;
+
+	//Seconds per step
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory", meta = (ClampMin = "0.0001"))
+	float TimeStep = 1.f / 30.f;
+
+	//Each trajectory produces up to NumSteps + 1 points, the first being its start position
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory", meta = (ClampMin = "1"))
+	int32 NumSteps = 60;
+
+	//Slow the velocity by the max linear damping of the zones at each point, like the manager does for bodies
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory")
+	bool bApplyZoneDamping = false;
+
+	//Sweep every step against the world and stop the trajectory at the first blocking hit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory")
+	bool bSweepCollision = false;
+
+	//Sphere radius of the sweep, 0 traces a line
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory", meta = (ClampMin = "0", EditCondition = "bSweepCollision"))
+	float CollisionRadius = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory", meta = (EditCondition = "bSweepCollision"))
+	TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_WorldStatic;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Trajectory", meta = (EditCondition = "bSweepCollision"))
+	TArray<TObjectPtr<AActor>> ActorsToIgnore;
+};
+
+/**
+ * One predicted trajectory in the form handed to Blueprint.
+ */
+USTRUCT(BlueprintType)
+struct FGravityTrajectory
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Trajectory")
+	TArray<FVector> Points;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Trajectory")
+	bool bHit = false;
+
+	//Blocking hit that ended the trajectory, the last point is its location
+	UPROPERTY(BlueprintReadOnly, Category = "Gravity Trajectory")
+	FHitResult Hit;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FGravityTrajectoriesPredicted, const TArray<FGravityTrajectory>&, Trajectories);
+
+/**
+ * Flat output of a batched prediction. Every trajectory owns NumSteps + 1 consecutive points of which the first
+ * NumPoints are valid, so a buffer reused between requests of the same size does not allocate.
+ */
+struct GRAVPLUGIN_API FGravityTrajectoryBuffer
+{
+	int32 Stride = 0;
+	TArray<FVector> Points;
+	TArray<int32> NumPoints;
+	TArray<FHitResult> Hits; //bBlockingHit is set on trajectories ended by a collision
+
+	void Reset(int32 NumTrajectories, int32 NumSteps);
+
+	int32 Num() const { return NumPoints.Num(); }
+	TConstArrayView<FVector> GetPoints(int32 Trajectory) const { return MakeArrayView(&Points[Trajectory * Stride], NumPoints[Trajectory]); }
+
+	void ToBlueprint(TArray<FGravityTrajectory>& OutTrajectories) const;
+};
+
+/**
+ * Integrates trajectories through a field snapshot. Trajectories are stepped together in chunks so every step costs
+ * one batched snapshot sample per chunk, or four with RK4, and each chunk runs on its own worker. Predict is safe to
+ * call from any thread while the snapshot and world stay alive, collision sweeps go through the world's scene queries.
+ */
+class GRAVPLUGIN_API FGravityTrajectoryPredictor
+{
+public:
+	//Ignored actors are resolved here, so construct on the game thread and hand the predictor to the worker
+	FGravityTrajectoryPredictor(const FGravityFieldSnapshot* InSnapshot, const UWorld* InCollisionWorld, const FGravityTrajectoryParams& Params);
+
+	void Predict(TConstArrayView<FGravityTrajectoryStart> Starts, FGravityTrajectoryBuffer& OutBuffer) const;
+
+	int32 ChunkSize = 32; //Trajectories stepped together by one worker
+	bool bParallel = true;
+
+private:
+	const FGravityFieldSnapshot* Snapshot = nullptr; //Null predicts straight lines
+	const UWorld* CollisionWorld = nullptr;          //Null skips the sweeps
+	EGravityTrajectoryIntegrator Integrator = EGravityTrajectoryIntegrator::SemiImplicitEuler;
+	double TimeStep = 0.0;
+	int32 NumSteps = 0;
+	bool bApplyZoneDamping = false;
+	ECollisionChannel CollisionChannel = ECC_WorldStatic;
+	FCollisionShape CollisionShape;
+	FCollisionQueryParams QueryParams;
+};
@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Math/GenericOctreePublic.h"
 #include "GravityManager.h"
+#include "GravityField.h"
 #include "GravityZone.generated.h"
 
+class UGravityFieldAsset;
+
 UCLASS()
 class GRAVPLUGIN_API AGravityZone : public AActor
 {
@@ -16,8 +20,12 @@ public:
 	AGravityZone();
 
 protected:
+	virtual void PostInitProperties() override;
 	virtual void BeginPlay() override;
 	virtual void BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 	//Overlap Bindings
 	UFUNCTION(BlueprintCallable, Category = "Gravity Zone")
@@ -28,21 +36,38 @@ protected:
 
 public:
 	//The zone priority, only the highest level zones an actor occupies will apply force
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetPriority, Category = "Gravity Zone")
 	int Priority;
 
 	//Defines a base vector, depending on implementation of GetGravityVector, this could be used directly, could be used to derive a magnitude, direction, etc
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
 	FVector BaseVector;
 
+	//Native field shape evaluated by the manager without calling into Blueprint, Custom uses GetGravityVector instead
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
+	EGravityFieldType FieldType;
+
+	//Distance from the origin, axis or plane within which radial, cylindrical and planar fields apply the full BaseVector magnitude
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone", meta = (ClampMin = "0"))
+	float FieldRadius;
+
+	//Falloff beyond FieldRadius as (FieldRadius / Distance) ^ FalloffExponent, 2 is inverse square and 0 disables falloff
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone", meta = (ClampMin = "0"))
+	float FalloffExponent;
+
+	//Baked field sampled when FieldType is BakedGrid, in the zone's local space
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
+	TObjectPtr<UGravityFieldAsset> FieldAsset;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
 	float LinearDamping; // Linear damping applied to physics objects in this zone
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
 	float AngularDamping; // Angular damping applied to physics objects in this zone
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity Zone")
-	TArray<FString> ExclusionTags; // Angular damping applied to physics objects in this zone
+	//Actors with any of these tags are ignored by this zone, resolved to a bit mask by the manager. Change it at runtime through SetExclusionTags
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetExclusionTags, Category = "Gravity Zone")
+	TArray<FString> ExclusionTags;
 
 	//Override to change the way the gravity is calculated given an obect at a world position
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Gravity Zone")
@@ -55,4 +80,42 @@ public:
 	//Override to change the way the gravity is calculated given an obect at a world position
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Gravity Zone")
 	double GetAngularDampening(const FVector& InWorldPosition) const;
+
+	//Changes Priority and has the manager re-resolve the active zones of every actor inside
+	UFUNCTION(BlueprintSetter)
+	void SetPriority(int NewPriority);
+
+	//Replaces ExclusionTags and has the manager rebuild this zone's exclusion mask from the names
+	UFUNCTION(BlueprintSetter)
+	void SetExclusionTags(const TArray<FString>& NewExclusionTags);
+
+	//Field type the manager will actually evaluate, Custom zones without an override behave as Uniform
+	EGravityFieldType GetEffectiveFieldType() const;
+
+	//Captures the native field description using the current actor transform
+	FGravityFieldParams GetFieldParams() const;
+
+	//Collects analytic copies of the zone's overlap shapes for position based membership queries
+	void GetZoneVolumes(TArray<FGravityZoneVolume, TInlineAllocator<1>>& OutVolumes) const;
+
+	//True when GetGravityVector is implemented by a Blueprint or native subclass, such zones can only be sampled on the game thread
+	bool HasCustomGravityVector() const { return bCustomGravityVector; }
+
+	//True when GetLinearDampening or GetAngularDampening is implemented by a Blueprint or native subclass
+	bool HasCustomDampening() const { return bCustomDampening; }
+
+private:
+	friend class UGravityManager;
+	friend struct FGravityZoneOctreeSemantics;
+
+	bool IsEventOverridden(FName EventName) const;
+
+	//Slot assigned by the gravity manager while this zone is known to it
+	FGravityZoneHandle ManagerHandle;
+
+	//Element in the manager's zone octree
+	FOctreeElementId2 OctreeId;
+
+	bool bCustomGravityVector = false;
+	bool bCustomDampening = false;
 };
@@ -0,0 +1,455 @@
+// --- GravityBenchmarkCommandlet.cpp ---
+#include "GravityBenchmarkCommandlet.h"
+#include "GravityManager.h"
+#include "GravityZone.h"
+#include "GravityStats.h"
+#include "GravityBarnesHut.h"
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Math/RandomStream.h"
+
+namespace GravityBenchmark
+{
+	constexpr double SpawnHalfHeight = 2000.0;
+	constexpr float TickDeltaTime = 1.f / 60.f;
+	constexpr int32 MaxBruteForceQueries = 2000;
+	constexpr double GravitationalConstant = 6.674e-5;
+	constexpr double Softening = 100.0;
+
+	//Counted by the allocator front end in non shipping builds, reallocations included since they usually move
+	uint64 GetAllocationCount()
+	{
+#if !UE_BUILD_SHIPPING
+		return uint64(FMalloc::TotalMallocCalls) + uint64(FMalloc::TotalReallocCalls);
+#else
+		return 0;
+#endif
+	}
+
+	template<typename ShapeType>
+	ShapeType* AddRootShape(AActor* Owner, const FVector& Location, FName CollisionProfile)
+	{
+		ShapeType* Shape = NewObject<ShapeType>(Owner);
+		Shape->SetCollisionProfileName(CollisionProfile);
+		Owner->SetRootComponent(Shape);
+		Shape->SetWorldLocation(Location);
+		return Shape;
+	}
+
+	TArray<FString> ParseList(const FString& Params, const TCHAR* Key)
+	{
+		TArray<FString> Items;
+		FString Value;
+		if (FParse::Value(*Params, Key, Value, false))
+		{
+			Value.ParseIntoArray(Items, TEXT(","));
+		}
+		return Items;
+	}
+}
+
+UGravityBenchmarkCommandlet::UGravityBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	HelpDescription = TEXT("Measures UGravityManager tick cost across zone layouts and actor counts");
+	HelpUsage = TEXT("-run=GravityBenchmark -nullrhi [-Actors=100,1000,10000,50000] [-Setups=Uniform,Radial,Overlapping] [-Zones=16] [-Ticks=120] [-Warmup=10] [-CharacterPercent=10] [-NBodySources=1000,10000,50000] [-Theta=0.5] [-Output=Path]");
+}
+
+int32 UGravityBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace GravityBenchmark;
+
+	TArray<int32> ActorCounts = { 100, 1000, 10000, 50000 };
+	if (TArray<FString> Items = ParseList(Params, TEXT("Actors=")); Items.Num() > 0)
+	{
+		ActorCounts.Reset();
+		for (const FString& Item : Items)
+		{
+			ActorCounts.Add(FMath::Max(FCString::Atoi(*Item), 0));
+		}
+	}
+
+	TArray<ESetup> Setups = { ESetup::Uniform, ESetup::Radial, ESetup::Overlapping };
+	if (TArray<FString> Items = ParseList(Params, TEXT("Setups=")); Items.Num() > 0)
+	{
+		Setups.Reset();
+		for (const FString& Item : Items)
+		{
+			for (ESetup Setup : { ESetup::Uniform, ESetup::Radial, ESetup::Overlapping })
+			{
+				if (Item.Equals(GetSetupName(Setup), ESearchCase::IgnoreCase))
+				{
+					Setups.Add(Setup);
+				}
+			}
+		}
+	}
+
+	TArray<int32> SourceCounts = { 1000, 10000, 50000 };
+	if (TArray<FString> Items = ParseList(Params, TEXT("NBodySources=")); Items.Num() > 0)
+	{
+		SourceCounts.Reset();
+		for (const FString& Item : Items)
+		{
+			SourceCounts.Add(FMath::Max(FCString::Atoi(*Item), 1));
+		}
+	}
+	double Theta = 0.5;
+	FParse::Value(*Params, TEXT("Theta="), Theta);
+
+	int32 NumZones = 16;
+	int32 NumTicks = 120;
+	int32 NumWarmupTicks = 10;
+	int32 CharacterPercent = 10;
+	FParse::Value(*Params, TEXT("Zones="), NumZones);
+	FParse::Value(*Params, TEXT("Ticks="), NumTicks);
+	FParse::Value(*Params, TEXT("Warmup="), NumWarmupTicks);
+	FParse::Value(*Params, TEXT("CharacterPercent="), CharacterPercent);
+	NumZones = FMath::Max(NumZones, 2);
+	NumTicks = FMath::Max(NumTicks, 1);
+	NumWarmupTicks = FMath::Max(NumWarmupTicks, 0);
+	CharacterPercent = FMath::Clamp(CharacterPercent, 0, 100);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), FString::Printf(TEXT("GravityBenchmark-%s"), *FDateTime::Now().ToString()));
+	}
+
+	TArray<FBenchmarkResult> Results;
+	for (ESetup Setup : Setups)
+	{
+		for (int32 NumActors : ActorCounts)
+		{
+			FBenchmarkCase Case;
+			Case.Setup = Setup;
+			Case.NumActors = NumActors;
+			Case.NumCharacters = NumActors * CharacterPercent / 100;
+			Case.NumZones = NumZones;
+
+			const FBenchmarkResult& Result = Results.Add_GetRef(RunCase(Case, NumTicks, NumWarmupTicks));
+			UE_LOG(LogGravity, Display, TEXT("%-12s actors %6d  zones %4d  mean %8.3f ms  median %8.3f ms  max %8.3f ms  allocs/tick %8.1f  zone evals/s %12.0f"),
+				GetSetupName(Setup), NumActors, NumZones, Result.MeanMs, Result.MedianMs, Result.MaxMs, Result.AllocationsPerTick, Result.ZoneEvaluationsPerSecond);
+		}
+	}
+
+	TArray<FNBodyResult> NBodyResults;
+	for (int32 NumSources : SourceCounts)
+	{
+		const FNBodyResult& Result = NBodyResults.Add_GetRef(RunNBodyCase(NumSources, Theta));
+		UE_LOG(LogGravity, Display, TEXT("N-body sources %6d  theta %.2f  build %8.3f ms  barnes-hut %10.3f ms  brute force %12.3f ms  error mean %.5f max %.5f"),
+			NumSources, Theta, Result.BuildMs, Result.BarnesHutMs, Result.BruteForceMs, Result.MeanRelativeError, Result.MaxRelativeError);
+	}
+
+	const bool bWritten = WriteCsv(OutputPath + TEXT(".csv"), Results) && WriteJson(OutputPath + TEXT(".json"), Results)
+		&& WriteNBodyCsv(OutputPath + TEXT("-nbody.csv"), NBodyResults) && WriteNBodyJson(OutputPath + TEXT("-nbody.json"), NBodyResults);
+	if (!bWritten)
+	{
+		UE_LOG(LogGravity, Error, TEXT("Failed to write benchmark results to %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogGravity, Display, TEXT("Wrote benchmark results to %s.csv and %s.json"), *OutputPath, *OutputPath);
+	return 0;
+}
+
+// --- Benchmark Cases ---
+UGravityBenchmarkCommandlet::FBenchmarkResult UGravityBenchmarkCommandlet::RunCase(const FBenchmarkCase& Case, int32 NumTicks, int32 NumWarmupTicks) const
+{
+	using namespace GravityBenchmark;
+
+	FBenchmarkResult Result;
+	Result.Case = Case;
+	Result.NumTicks = NumTicks;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GravityBenchmark"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+
+	UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>();
+	if (GravityManager)
+	{
+		//Every actor is processed every tick so runs are comparable
+		GravityManager->TierPolicy.ReducedRateDistance = 0.f;
+		GravityManager->TierPolicy.bSkipSleepingBodies = false;
+
+		SpawnZones(World, Case);
+		SpawnActors(World, Case);
+
+		for (int32 TickIndex = 0; TickIndex < NumWarmupTicks; ++TickIndex)
+		{
+			GravityManager->Tick(TickDeltaTime);
+		}
+
+		TArray<double> TickMs;
+		TickMs.Reserve(NumTicks);
+		uint64 NumAllocations = 0;
+		uint64 NumZoneEvaluations = 0;
+		for (int32 TickIndex = 0; TickIndex < NumTicks; ++TickIndex)
+		{
+			const uint64 AllocationsBefore = GetAllocationCount();
+			const double StartTime = FPlatformTime::Seconds();
+			GravityManager->Tick(TickDeltaTime);
+			TickMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+			NumAllocations += GetAllocationCount() - AllocationsBefore;
+			NumZoneEvaluations += GravityManager->GetLastTickStats().ZoneEvaluations;
+		}
+
+		double TotalMs = 0.0;
+		for (double Ms : TickMs)
+		{
+			TotalMs += Ms;
+			Result.MaxMs = FMath::Max(Result.MaxMs, Ms);
+		}
+		TickMs.Sort();
+		Result.MeanMs = TotalMs / NumTicks;
+		Result.MedianMs = TickMs[NumTicks / 2];
+		Result.AllocationsPerTick = double(NumAllocations) / NumTicks;
+		Result.ZoneEvaluationsPerSecond = TotalMs > 0.0 ? NumZoneEvaluations / (TotalMs / 1000.0) : 0.0;
+	}
+	else
+	{
+		UE_LOG(LogGravity, Error, TEXT("No gravity manager was created for the benchmark world"));
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	return Result;
+}
+
+void UGravityBenchmarkCommandlet::SpawnZones(UWorld* World, const FBenchmarkCase& Case) const
+{
+	using namespace GravityBenchmark;
+
+	UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>();
+	const FName ZoneProfile = TEXT("OverlapAllDynamic");
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(double(Case.NumZones)));
+	const double TileSize = 2.0 * SpawnHalfExtent / GridSize;
+
+	int32 FirstTile = 0;
+	if (Case.Setup == ESetup::Overlapping)
+	{
+		//Lowest priority zone under the whole area, the tiles above it win wherever they reach
+		AGravityZone* Zone = World->SpawnActor<AGravityZone>();
+		UBoxComponent* Box = AddRootShape<UBoxComponent>(Zone, FVector::ZeroVector, ZoneProfile);
+		Box->SetBoxExtent(FVector(SpawnHalfExtent, SpawnHalfExtent, SpawnHalfHeight));
+		Box->RegisterComponent();
+		Zone->FieldType = EGravityFieldType::Uniform;
+		GravityManager->RegisterGravityZone(Zone);
+		FirstTile = 1;
+	}
+
+	for (int32 TileIndex = FirstTile; TileIndex < Case.NumZones; ++TileIndex)
+	{
+		const int32 GridIndex = TileIndex - FirstTile;
+		const FVector Center(
+			-SpawnHalfExtent + TileSize * ((GridIndex % GridSize) + 0.5),
+			-SpawnHalfExtent + TileSize * ((GridIndex / GridSize) + 0.5),
+			0.0);
+
+		AGravityZone* Zone = World->SpawnActor<AGravityZone>();
+		if (Case.Setup == ESetup::Uniform)
+		{
+			UBoxComponent* Box = AddRootShape<UBoxComponent>(Zone, Center, ZoneProfile);
+			Box->SetBoxExtent(FVector(TileSize * 0.5, TileSize * 0.5, SpawnHalfHeight));
+			Box->RegisterComponent();
+			Zone->FieldType = EGravityFieldType::Uniform;
+		}
+		else
+		{
+			//Spheres reach past the tile corners so neighbouring zones overlap
+			USphereComponent* Sphere = AddRootShape<USphereComponent>(Zone, Center, ZoneProfile);
+			Sphere->SetSphereRadius(TileSize * 0.75);
+			Sphere->RegisterComponent();
+			Zone->FieldType = EGravityFieldType::Radial;
+			Zone->FieldRadius = TileSize * 0.25;
+			Zone->Priority = Case.Setup == ESetup::Overlapping ? 1 + (GridIndex % 3) : 0;
+		}
+		GravityManager->RegisterGravityZone(Zone);
+	}
+}
+
+void UGravityBenchmarkCommandlet::SpawnActors(UWorld* World, const FBenchmarkCase& Case) const
+{
+	using namespace GravityBenchmark;
+
+	UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>();
+	FRandomStream Random(Case.NumActors);
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 ActorIndex = 0; ActorIndex < Case.NumActors; ++ActorIndex)
+	{
+		const FVector Location(
+			Random.FRandRange(-SpawnHalfExtent, SpawnHalfExtent),
+			Random.FRandRange(-SpawnHalfExtent, SpawnHalfExtent),
+			Random.FRandRange(-SpawnHalfHeight, SpawnHalfHeight));
+
+		AActor* AffectedActor = nullptr;
+		if (ActorIndex < Case.NumCharacters)
+		{
+			AffectedActor = World->SpawnActor<ACharacter>(Location, FRotator::ZeroRotator, SpawnParams);
+		}
+		else
+		{
+			AffectedActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+			USphereComponent* Sphere = AddRootShape<USphereComponent>(AffectedActor, Location, UCollisionProfile::PhysicsActor_ProfileName);
+			Sphere->SetSphereRadius(50.f);
+			Sphere->SetEnableGravity(false);
+			Sphere->SetSimulatePhysics(true);
+			Sphere->RegisterComponent();
+		}
+
+		//Position queries keep membership independent of overlap events, which need the world to tick
+		GravityManager->RegisterPositionQueryActor(AffectedActor);
+	}
+}
+
+// --- N-Body ---
+UGravityBenchmarkCommandlet::FNBodyResult UGravityBenchmarkCommandlet::RunNBodyCase(int32 NumSources, double Theta) const
+{
+	using namespace GravityBenchmark;
+
+	FNBodyResult Result;
+	Result.NumSources = NumSources;
+	Result.Theta = Theta;
+
+	FRandomStream Random(NumSources);
+	TArray<FVector> Positions;
+	TArray<double> Masses;
+	TArray<int32> Keys;
+	for (int32 Index = 0; Index < NumSources; ++Index)
+	{
+		Positions.Add(FVector(Random.FRandRange(-SpawnHalfExtent, SpawnHalfExtent), Random.FRandRange(-SpawnHalfExtent, SpawnHalfExtent), Random.FRandRange(-SpawnHalfExtent, SpawnHalfExtent)));
+		Masses.Add(Random.FRandRange(1.0e12, 1.0e15));
+		Keys.Add(Index);
+	}
+
+	FGravityBarnesHutTree Tree;
+	double StartTime = FPlatformTime::Seconds();
+	Tree.Build(Positions, Masses, Keys);
+	Result.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	//Single threaded on both sides so the numbers compare the algorithms rather than the worker count
+	TArray<FVector> Approximate;
+	Approximate.SetNumUninitialized(NumSources);
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumSources; ++Index)
+	{
+		Approximate[Index] = Tree.Evaluate(Positions[Index], Index, Theta, GravitationalConstant, Softening);
+	}
+	Result.BarnesHutMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	const int32 NumQueries = FMath::Min(NumSources, MaxBruteForceQueries);
+	const int32 Stride = NumSources / NumQueries;
+	double ErrorSum = 0.0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Query = 0; Query < NumQueries; ++Query)
+	{
+		const int32 Index = Query * Stride;
+		const FVector Exact = Tree.EvaluateBruteForce(Positions[Index], Index, GravitationalConstant, Softening);
+		const double Error = (Approximate[Index] - Exact).Size() / FMath::Max(Exact.Size(), UE_DOUBLE_SMALL_NUMBER);
+		ErrorSum += Error;
+		Result.MaxRelativeError = FMath::Max(Result.MaxRelativeError, Error);
+	}
+	Result.BruteForceMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 * NumSources / NumQueries;
+	Result.MeanRelativeError = ErrorSum / NumQueries;
+	return Result;
+}
+
+// --- Results ---
+const TCHAR* UGravityBenchmarkCommandlet::GetSetupName(ESetup Setup)
+{
+	switch (Setup)
+	{
+	case ESetup::Radial:
+		return TEXT("Radial");
+	case ESetup::Overlapping:
+		return TEXT("Overlapping");
+	default:
+		return TEXT("Uniform");
+	}
+}
+
+bool UGravityBenchmarkCommandlet::WriteCsv(const FString& Path, const TArray<FBenchmarkResult>& Results) const
+{
+	FString Csv = TEXT("Setup,Actors,Characters,Zones,Ticks,MeanMs,MedianMs,MaxMs,AllocationsPerTick,ZoneEvaluationsPerSecond\n");
+	for (const FBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.2f,%.0f\n"),
+			GetSetupName(Result.Case.Setup), Result.Case.NumActors, Result.Case.NumCharacters, Result.Case.NumZones, Result.NumTicks,
+			Result.MeanMs, Result.MedianMs, Result.MaxMs, Result.AllocationsPerTick, Result.ZoneEvaluationsPerSecond);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool UGravityBenchmarkCommandlet::WriteJson(const FString& Path, const TArray<FBenchmarkResult>& Results) const
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteArrayStart();
+	for (const FBenchmarkResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("setup"), GetSetupName(Result.Case.Setup));
+		Writer->WriteValue(TEXT("actors"), Result.Case.NumActors);
+		Writer->WriteValue(TEXT("characters"), Result.Case.NumCharacters);
+		Writer->WriteValue(TEXT("zones"), Result.Case.NumZones);
+		Writer->WriteValue(TEXT("ticks"), Result.NumTicks);
+		Writer->WriteValue(TEXT("meanMs"), Result.MeanMs);
+		Writer->WriteValue(TEXT("medianMs"), Result.MedianMs);
+		Writer->WriteValue(TEXT("maxMs"), Result.MaxMs);
+		Writer->WriteValue(TEXT("allocationsPerTick"), Result.AllocationsPerTick);
+		Writer->WriteValue(TEXT("zoneEvaluationsPerSecond"), Result.ZoneEvaluationsPerSecond);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->Close();
+	return FFileHelper::SaveStringToFile(Json, *Path);
+}
+
+bool UGravityBenchmarkCommandlet::WriteNBodyCsv(const FString& Path, const TArray<FNBodyResult>& Results) const
+{
+	FString Csv = TEXT("Sources,Theta,BuildMs,BarnesHutMs,BruteForceMs,MeanRelativeError,MaxRelativeError\n");
+	for (const FNBodyResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%d,%.3f,%.4f,%.4f,%.4f,%.6f,%.6f\n"), Result.NumSources, Result.Theta, Result.BuildMs, Result.BarnesHutMs,
+			Result.BruteForceMs, Result.MeanRelativeError, Result.MaxRelativeError);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Path);
+}
+
+bool UGravityBenchmarkCommandlet::WriteNBodyJson(const FString& Path, const TArray<FNBodyResult>& Results) const
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteArrayStart();
+	for (const FNBodyResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("sources"), Result.NumSources);
+		Writer->WriteValue(TEXT("theta"), Result.Theta);
+		Writer->WriteValue(TEXT("buildMs"), Result.BuildMs);
+		Writer->WriteValue(TEXT("barnesHutMs"), Result.BarnesHutMs);
+		Writer->WriteValue(TEXT("bruteForceMs"), Result.BruteForceMs);
+		Writer->WriteValue(TEXT("meanRelativeError"), Result.MeanRelativeError);
+		Writer->WriteValue(TEXT("maxRelativeError"), Result.MaxRelativeError);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->Close();
+	return FFileHelper::SaveStringToFile(Json, *Path);
+}
@@ -0,0 +1,84 @@
+// --- GravityBenchmarkCommandlet.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GravityBenchmarkCommandlet.generated.h"
+
+class UWorld;
+
+/**
+ * Headless scaling benchmark for UGravityManager. Spawns zone layouts and gravity actors into a fresh game world,
+ * ticks the manager directly and writes ms/tick, allocations per tick and zone evaluations per second to CSV and JSON.
+ *
+ * UnrealEditor-Cmd <Project> -run=GravityBenchmark -nullrhi [-Actors=100,1000,10000,50000] [-Setups=Uniform,Radial,Overlapping]
+ *     [-Zones=16] [-Ticks=120] [-Warmup=10] [-CharacterPercent=10] [-Output=<path without extension>]
+ *     [-NBodySources=1000,10000,50000] [-Theta=0.5]
+ *
+ * The n-body pass compares the Barnes-Hut source tree against the brute force sum and writes <Output>-nbody.csv/json.
+ */
+UCLASS()
+class UGravityBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGravityBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	enum class ESetup : uint8
+	{
+		Uniform,     //Uniform zones tiling the spawn area, one zone per actor
+		Radial,      //Radial zones with overlapping spheres, several same priority zones per actor
+		Overlapping  //A world sized zone under alternating priority tiles, exercises priority masking
+	};
+
+	struct FBenchmarkCase
+	{
+		ESetup Setup = ESetup::Uniform;
+		int32 NumActors = 0;
+		int32 NumCharacters = 0;
+		int32 NumZones = 0;
+	};
+
+	struct FBenchmarkResult
+	{
+		FBenchmarkCase Case;
+		int32 NumTicks = 0;
+		double MeanMs = 0.0;
+		double MedianMs = 0.0;
+		double MaxMs = 0.0;
+		double AllocationsPerTick = 0.0;
+		double ZoneEvaluationsPerSecond = 0.0;
+	};
+
+	struct FNBodyResult
+	{
+		int32 NumSources = 0;
+		double Theta = 0.0;
+		double BuildMs = 0.0;
+		double BarnesHutMs = 0.0;     //Evaluating every source against the tree
+		double BruteForceMs = 0.0;    //Same work with the direct sum, extrapolated from a subset at large counts
+		double MeanRelativeError = 0.0;
+		double MaxRelativeError = 0.0;
+	};
+
+	FNBodyResult RunNBodyCase(int32 NumSources, double Theta) const;
+	bool WriteNBodyCsv(const FString& Path, const TArray<FNBodyResult>& Results) const;
+	bool WriteNBodyJson(const FString& Path, const TArray<FNBodyResult>& Results) const;
+
+	FBenchmarkResult RunCase(const FBenchmarkCase& Case, int32 NumTicks, int32 NumWarmupTicks) const;
+	void SpawnZones(UWorld* World, const FBenchmarkCase& Case) const;
+	void SpawnActors(UWorld* World, const FBenchmarkCase& Case) const;
+
+	bool WriteCsv(const FString& Path, const TArray<FBenchmarkResult>& Results) const;
+	bool WriteJson(const FString& Path, const TArray<FBenchmarkResult>& Results) const;
+
+	static const TCHAR* GetSetupName(ESetup Setup);
+
+	//Half size of the cube actors are spawned in
+	static constexpr double SpawnHalfExtent = 20000.0;
+};
@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class GravPluginMass : ModuleRules
+{
+	public GravPluginMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"MassEntity",
+				"MassCommon",
+				"MassMovement",
+				"MassSpawner",
+				"GravPlugin"
+			}
+			);
+
+	}
+}
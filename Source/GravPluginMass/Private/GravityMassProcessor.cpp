@@ -0,0 +1,80 @@
+// --- GravityMassProcessor.cpp ---
+#include "GravityMassProcessor.h"
+#include "GravityMassFragments.h"
+#include "GravityManager.h"
+#include "GravityStats.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassExecutionContext.h"
+#include "MassMovementFragments.h"
+#include "MassEntityTemplateRegistry.h"
+#include "Engine/World.h"
+
+void UGravityMassTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.RequireFragment<FTransformFragment>();
+	BuildContext.AddFragment<FMassVelocityFragment>();
+	FGravityMassFragment& GravityFragment = BuildContext.AddFragment_GetRef<FGravityMassFragment>();
+	GravityFragment.GravityScale = GravityScale;
+}
+
+UGravityMassProcessor::UGravityMassProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = int32(EProcessorExecutionFlags::All);
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionOrder.ExecuteBefore.Add(UE::Mass::ProcessorGroupNames::Movement);
+}
+
+void UGravityMassProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FGravityMassFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+void UGravityMassProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GravityMassProcessor, GravityChannel);
+
+	const UWorld* World = EntityManager.GetWorld();
+	const UGravityManager* GravityManager = World ? World->GetSubsystem<UGravityManager>() : nullptr;
+	if (!GravityManager || (!GravityManager->UseGravity && !GravityManager->UseDampen)) return;
+
+	//Zones moved since the snapshot was taken are one frame behind, the same as the actor path
+	const TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> FieldSnapshot = GravityManager->GetFieldSnapshot();
+	if (!FieldSnapshot.IsValid() || FieldSnapshot->Zones.Num() == 0) return;
+
+	const bool bUseGravity = GravityManager->UseGravity;
+	const bool bUseDampen = GravityManager->UseDampen;
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this, &FieldSnapshot, bUseGravity, bUseDampen](FMassExecutionContext& ChunkContext)
+	{
+		const int32 NumEntities = ChunkContext.GetNumEntities();
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FMassVelocityFragment> Velocities = ChunkContext.GetMutableFragmentView<FMassVelocityFragment>();
+		const TArrayView<FGravityMassFragment> GravityFragments = ChunkContext.GetMutableFragmentView<FGravityMassFragment>();
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+
+		Positions.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		Gravity.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		Damping.SetNumUninitialized(NumEntities, EAllowShrinking::No);
+		for (int32 Index = 0; Index < NumEntities; ++Index)
+		{
+			Positions[Index] = Transforms[Index].GetTransform().GetLocation();
+		}
+
+		FieldSnapshot->SampleBatch(Positions, Gravity, Damping, Scratch);
+
+		for (int32 Index = 0; Index < NumEntities; ++Index)
+		{
+			FGravityMassFragment& GravityFragment = GravityFragments[Index];
+			GravityFragment.Gravity = bUseGravity ? Gravity[Index] * GravityFragment.GravityScale : FVector::ZeroVector;
+			GravityFragment.Damping = bUseDampen ? Damping[Index] : FVector2f::ZeroVector;
+
+			//Same linear damping model as Chaos rigid bodies
+			FVector& Velocity = Velocities[Index].Value;
+			Velocity += GravityFragment.Gravity * DeltaTime;
+			Velocity *= 1.0 / (1.0 + DeltaTime * GravityFragment.Damping.X);
+		}
+	});
+}
@@ -0,0 +1,46 @@
+// --- GravityMassFragments.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "MassEntityTraitBase.h"
+#include "GravityMassFragments.generated.h"
+
+/**
+ * Marks a Mass entity as affected by gravity zones and holds the result of the last update.
+ * Requires FTransformFragment for the sample position and FMassVelocityFragment to apply to.
+ */
+USTRUCT()
+struct GRAVPLUGINMASS_API FGravityMassFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	//Multiplier on the zone gravity for this entity
+	UPROPERTY(EditAnywhere, Category = "Gravity")
+	float GravityScale = 1.f;
+
+	//Net zone gravity from the last update, in cm/s^2
+	UPROPERTY(VisibleAnywhere, Category = "Gravity")
+	FVector Gravity = FVector::ZeroVector;
+
+	//Linear and angular damping of the zones the entity was in on the last update
+	UPROPERTY(VisibleAnywhere, Category = "Gravity")
+	FVector2f Damping = FVector2f::ZeroVector;
+};
+
+/**
+ * Adds the fragments UGravityMassProcessor needs to an entity config.
+ */
+UCLASS(meta = (DisplayName = "Gravity Affected"))
+class GRAVPLUGINMASS_API UGravityMassTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Gravity")
+	float GravityScale = 1.f;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
@@ -0,0 +1,35 @@
+// --- GravityMassProcessor.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "GravityFieldSnapshot.h"
+#include "GravityMassProcessor.generated.h"
+
+/**
+ * Applies gravity zones to Mass entities chunk by chunk. Each chunk's positions go through the manager's field snapshot,
+ * which groups them per zone and runs the same field kernels and priority rules as actors, before velocity is integrated.
+ * Entities have no grounded state, so they always sum their highest priority zones like airborne actors.
+ */
+UCLASS()
+class GRAVPLUGINMASS_API UGravityMassProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UGravityMassProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+
+	//Per chunk working memory, chunks are processed one at a time
+	FGravityFieldSnapshot::FBatchScratch Scratch;
+	TArray<FVector> Positions;
+	TArray<FVector> Gravity;
+	TArray<FVector2f> Damping;
+};
@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class GravPluginNiagara : ModuleRules
+{
+	public GravPluginNiagara(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"Niagara",
+				"NiagaraCore",
+				"VectorVM",
+				"GravPlugin"
+			}
+			);
+
+	}
+}
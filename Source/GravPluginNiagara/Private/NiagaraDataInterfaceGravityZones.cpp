@@ -0,0 +1,210 @@
+// --- NiagaraDataInterfaceGravityZones.cpp ---
+#include "NiagaraDataInterfaceGravityZones.h"
+#include "GravityFieldSnapshot.h"
+#include "GravityManager.h"
+#include "GravityStats.h"
+#include "NiagaraSystemInstance.h"
+#include "NiagaraTypes.h"
+#include "VectorVM.h"
+#include "Engine/World.h"
+
+#define LOCTEXT_NAMESPACE "NiagaraDataInterfaceGravityZones"
+
+namespace GravityZonesNDI
+{
+	static const FName SampleGravityName(TEXT("SampleGravity"));
+	static const FName SampleGravityAndDampingName(TEXT("SampleGravityAndDamping"));
+
+	struct FInstanceData
+	{
+		TWeakObjectPtr<const UGravityManager> Manager;
+		TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> FieldSnapshot; //This frame's zones, null when there is nothing to sample
+		FVector LWCTileOffset = FVector::ZeroVector; //Simulation positions are relative to the system's large world tile
+		FTransform LocalToWorld = FTransform::Identity; //Local space emitters simulate relative to the system's component instead
+		bool bUseGravity = false;
+		bool bUseDampen = false;
+	};
+
+	//Kept per thread, emitters of the same system can run their chunks in parallel against one instance
+	struct FChunkScratch
+	{
+		FGravityFieldSnapshot::FBatchScratch Batch;
+		TArray<FVector> Positions;
+		TArray<FVector> Gravity;
+		TArray<FVector2f> Damping;
+		TArray<bool> LocalSpace;
+	};
+
+	//Runs a chunk's positions through the snapshot as one batch, null when the outputs should be zero. Local space positions
+	//are moved to world space for the zones and their gravity is rotated back, so callers always get the emitter's space
+	static const FChunkScratch* SampleChunk(const FInstanceData& InstanceData, FNDIInputParam<FNiagaraPosition>& InPosition, FNDIInputParam<bool>& InLocalSpace, int32 NumInstances, bool bWithDamping)
+	{
+		if (!InstanceData.FieldSnapshot.IsValid()) return nullptr;
+
+		static thread_local FChunkScratch Scratch;
+		Scratch.Positions.SetNumUninitialized(NumInstances, EAllowShrinking::No);
+		Scratch.Gravity.SetNumUninitialized(NumInstances, EAllowShrinking::No);
+		Scratch.Damping.SetNumUninitialized(bWithDamping ? NumInstances : 0, EAllowShrinking::No);
+		Scratch.LocalSpace.SetNumUninitialized(NumInstances, EAllowShrinking::No);
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const FVector Position(InPosition.GetAndAdvance());
+			const bool bLocalSpace = InLocalSpace.GetAndAdvance();
+			Scratch.LocalSpace[Index] = bLocalSpace;
+			Scratch.Positions[Index] = bLocalSpace ? InstanceData.LocalToWorld.TransformPosition(Position) : Position + InstanceData.LWCTileOffset;
+		}
+
+		InstanceData.FieldSnapshot->SampleBatch(Scratch.Positions, Scratch.Gravity, Scratch.Damping, Scratch.Batch);
+
+		//Only rotated, gravity stays in cm/s^2 whatever the component's scale
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			if (Scratch.LocalSpace[Index])
+			{
+				Scratch.Gravity[Index] = InstanceData.LocalToWorld.InverseTransformVectorNoScale(Scratch.Gravity[Index]);
+			}
+		}
+		return &Scratch;
+	}
+}
+
+void UNiagaraDataInterfaceGravityZones::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		const ENiagaraTypeRegistryFlags Flags = ENiagaraTypeRegistryFlags::AllowAnyVariable | ENiagaraTypeRegistryFlags::AllowParameter;
+		FNiagaraTypeRegistry::Register(FNiagaraTypeDefinition(GetClass()), Flags);
+	}
+}
+
+#if WITH_EDITORONLY_DATA
+void UNiagaraDataInterfaceGravityZones::GetFunctionsInternal(TArray<FNiagaraFunctionSignature>& OutFunctions) const
+{
+	FNiagaraFunctionSignature BaseSignature;
+	BaseSignature.bMemberFunction = true;
+	BaseSignature.bRequiresContext = false;
+	BaseSignature.bSupportsCPU = true;
+	BaseSignature.bSupportsGPU = false;
+	BaseSignature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GravityZones")));
+	BaseSignature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetPositionDef(), TEXT("Position")));
+	BaseSignature.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TEXT("LocalSpace")));
+	BaseSignature.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("Gravity")));
+
+	FNiagaraFunctionSignature& SampleGravity = OutFunctions.Add_GetRef(BaseSignature);
+	SampleGravity.Name = GravityZonesNDI::SampleGravityName;
+	SampleGravity.SetDescription(LOCTEXT("SampleGravityDesc", "Net gravity of the zones at a position, in cm/s^2. Zero outside every zone. Pass Emitter.LocalSpace so local space positions are placed by the system's transform and the gravity comes back in the emitter's space."));
+
+	FNiagaraFunctionSignature& SampleGravityAndDamping = OutFunctions.Add_GetRef(BaseSignature);
+	SampleGravityAndDamping.Name = GravityZonesNDI::SampleGravityAndDampingName;
+	SampleGravityAndDamping.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("LinearDamping")));
+	SampleGravityAndDamping.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("AngularDamping")));
+	SampleGravityAndDamping.SetDescription(LOCTEXT("SampleGravityAndDampingDesc", "Net gravity of the zones at a position and the damping of the zones it is in. Pass Emitter.LocalSpace so local space positions are placed by the system's transform and the gravity comes back in the emitter's space."));
+}
+#endif
+
+void UNiagaraDataInterfaceGravityZones::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc)
+{
+	if (BindingInfo.Name == GravityZonesNDI::SampleGravityName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGravityZones::VMSampleGravity);
+	}
+	else if (BindingInfo.Name == GravityZonesNDI::SampleGravityAndDampingName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGravityZones::VMSampleGravityAndDamping);
+	}
+}
+
+// --- Instance Data ---
+int32 UNiagaraDataInterfaceGravityZones::PerInstanceDataSize() const
+{
+	return sizeof(GravityZonesNDI::FInstanceData);
+}
+
+bool UNiagaraDataInterfaceGravityZones::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	GravityZonesNDI::FInstanceData* InstanceData = new (PerInstanceData) GravityZonesNDI::FInstanceData();
+	const UWorld* World = SystemInstance->GetWorld();
+	InstanceData->Manager = World ? World->GetSubsystem<UGravityManager>() : nullptr;
+	return true;
+}
+
+void UNiagaraDataInterfaceGravityZones::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
+{
+	static_cast<GravityZonesNDI::FInstanceData*>(PerInstanceData)->~FInstanceData();
+}
+
+bool UNiagaraDataInterfaceGravityZones::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	GravityZonesNDI::FInstanceData* InstanceData = static_cast<GravityZonesNDI::FInstanceData*>(PerInstanceData);
+	InstanceData->FieldSnapshot.Reset();
+	InstanceData->LWCTileOffset = FVector(SystemInstance->GetLWCTile()) * FLargeWorldRenderScalar::GetTileSize();
+	InstanceData->LocalToWorld = SystemInstance->GetWorldTransform();
+
+	//Captured once here so every particle of the frame sees the same zones, moved zones are one frame behind like Mass entities
+	const UGravityManager* GravityManager = InstanceData->Manager.Get();
+	InstanceData->bUseGravity = GravityManager && GravityManager->UseGravity;
+	InstanceData->bUseDampen = GravityManager && GravityManager->UseDampen;
+	if (InstanceData->bUseGravity || InstanceData->bUseDampen)
+	{
+		TSharedPtr<const FGravityFieldSnapshot, ESPMode::ThreadSafe> FieldSnapshot = GravityManager->GetFieldSnapshot();
+		if (FieldSnapshot.IsValid() && FieldSnapshot->Zones.Num() > 0)
+		{
+			InstanceData->FieldSnapshot = MoveTemp(FieldSnapshot);
+		}
+	}
+	return false;
+}
+
+bool UNiagaraDataInterfaceGravityZones::PerInstanceTickPostSimulate(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
+{
+	//Let go after the simulation so the manager can refill the snapshot in place instead of allocating a new one
+	static_cast<GravityZonesNDI::FInstanceData*>(PerInstanceData)->FieldSnapshot.Reset();
+	return false;
+}
+
+// --- VM Functions ---
+void UNiagaraDataInterfaceGravityZones::VMSampleGravity(FVectorVMExternalFunctionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(NiagaraGravityZones, GravityChannel);
+
+	VectorVM::FUserPtrHandler<GravityZonesNDI::FInstanceData> InstanceData(Context);
+	FNDIInputParam<FNiagaraPosition> InPosition(Context);
+	FNDIInputParam<bool> InLocalSpace(Context);
+	FNDIOutputParam<FVector3f> OutGravity(Context);
+
+	const int32 NumInstances = Context.GetNumInstances();
+	const GravityZonesNDI::FChunkScratch* Scratch = GravityZonesNDI::SampleChunk(*InstanceData, InPosition, InLocalSpace, NumInstances, false);
+	const bool bGravity = Scratch && InstanceData->bUseGravity;
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		OutGravity.SetAndAdvance(bGravity ? FVector3f(Scratch->Gravity[Index]) : FVector3f::ZeroVector);
+	}
+}
+
+void UNiagaraDataInterfaceGravityZones::VMSampleGravityAndDamping(FVectorVMExternalFunctionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(NiagaraGravityZones, GravityChannel);
+
+	VectorVM::FUserPtrHandler<GravityZonesNDI::FInstanceData> InstanceData(Context);
+	FNDIInputParam<FNiagaraPosition> InPosition(Context);
+	FNDIInputParam<bool> InLocalSpace(Context);
+	FNDIOutputParam<FVector3f> OutGravity(Context);
+	FNDIOutputParam<float> OutLinearDamping(Context);
+	FNDIOutputParam<float> OutAngularDamping(Context);
+
+	const int32 NumInstances = Context.GetNumInstances();
+	const GravityZonesNDI::FChunkScratch* Scratch = GravityZonesNDI::SampleChunk(*InstanceData, InPosition, InLocalSpace, NumInstances, true);
+	const bool bGravity = Scratch && InstanceData->bUseGravity;
+	const bool bDampen = Scratch && InstanceData->bUseDampen;
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		const FVector2f Damping = bDampen ? Scratch->Damping[Index] : FVector2f::ZeroVector;
+		OutGravity.SetAndAdvance(bGravity ? FVector3f(Scratch->Gravity[Index]) : FVector3f::ZeroVector);
+		OutLinearDamping.SetAndAdvance(Damping.X);
+		OutAngularDamping.SetAndAdvance(Damping.Y);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,44 @@
+// --- NiagaraDataInterfaceGravityZones.h ---
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NiagaraDataInterface.h"
+#include "NiagaraDataInterfaceGravityZones.generated.h"
+
+/**
+ * Lets CPU emitters sample the gravity manager's zones. The field snapshot is captured once per frame for each system
+ * instance, and each VM chunk of particles goes through it as one batch with the same field kernels and priority rules
+ * as Mass entities. Particles have no grounded state, so they always sum their highest priority zones. Gravity sources
+ * are not included and Blueprint implemented zones contribute their BaseVector. Local space emitters pass LocalSpace so
+ * their positions are placed by the system's transform and the gravity is rotated back into the emitter's space.
+ */
+UCLASS(EditInlineNew, Category = "Gravity", CollapseCategories, meta = (DisplayName = "Gravity Zones"))
+class GRAVPLUGINNIAGARA_API UNiagaraDataInterfaceGravityZones : public UNiagaraDataInterface
+{
+	GENERATED_BODY()
+
+public:
+	//UObject Interface
+	virtual void PostInitProperties() override;
+
+	//UNiagaraDataInterface Interface
+	virtual bool CanExecuteOnTarget(ENiagaraSimTarget Target) const override { return Target == ENiagaraSimTarget::CPUSim; }
+	virtual void GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc) override;
+	virtual bool InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual void DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance) override;
+	virtual int32 PerInstanceDataSize() const override;
+	virtual bool PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+	virtual bool PerInstanceTickPostSimulate(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds) override;
+	virtual bool HasPreSimulateTick() const override { return true; }
+	virtual bool HasPostSimulateTick() const override { return true; }
+
+protected:
+#if WITH_EDITORONLY_DATA
+	virtual void GetFunctionsInternal(TArray<FNiagaraFunctionSignature>& OutFunctions) const override;
+#endif
+
+private:
+	void VMSampleGravity(FVectorVMExternalFunctionContext& Context);
+	void VMSampleGravityAndDamping(FVectorVMExternalFunctionContext& Context);
+};
@@ -0,0 +1,126 @@
+// --- GravityFallParityTest.cpp ---
+#include "GravityManager.h"
+#include "GravityZone.h"
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GravityFallParity
+{
+	constexpr float TickDeltaTime = 1.f / 60.f;
+	constexpr int32 NumFrames = 60;
+	constexpr double ZoneGravity = 980.0;
+
+	enum class EGravityPath : uint8
+	{
+		GravityGroup, //Uniform zone handed to a Chaos gravity group, integrated by the solver
+		Force,        //Groups disabled, the manager adds the force on the game thread every frame
+		Substep       //Groups disabled, the sim callback adds the force on the physics thread before every step
+	};
+
+	const TCHAR* GetPathName(EGravityPath Path)
+	{
+		switch (Path)
+		{
+		case EGravityPath::GravityGroup:
+			return TEXT("gravity group");
+		case EGravityPath::Substep:
+			return TEXT("substep");
+		default:
+			return TEXT("force");
+		}
+	}
+
+	//Drops a physics sphere through a uniform zone for NumFrames world ticks and returns how far it fell, negative on failure
+	double MeasureFall(EGravityPath Path, float MassScale)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GravityFallParity"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->bShouldSimulatePhysics = true;
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		double Distance = -1.0;
+		if (UGravityManager* GravityManager = World->GetSubsystem<UGravityManager>())
+		{
+			GravityManager->UseGravityGroups = Path == EGravityPath::GravityGroup;
+			GravityManager->UsePhysicsSubstep = Path == EGravityPath::Substep;
+
+			AGravityZone* Zone = World->SpawnActor<AGravityZone>();
+			UBoxComponent* Box = NewObject<UBoxComponent>(Zone);
+			Box->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+			Box->SetBoxExtent(FVector(100000.0));
+			Zone->SetRootComponent(Box);
+			Box->RegisterComponent();
+			Zone->FieldType = EGravityFieldType::Uniform;
+			Zone->BaseVector = FVector(0.0, 0.0, -ZoneGravity);
+			GravityManager->RegisterGravityZone(Zone);
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			AActor* Faller = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+			USphereComponent* Sphere = NewObject<USphereComponent>(Faller);
+			Sphere->SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
+			Faller->SetRootComponent(Sphere);
+			Sphere->SetSphereRadius(50.f);
+			Sphere->SetEnableGravity(false);
+			Sphere->SetLinearDamping(0.f);
+			Sphere->BodyInstance.MassScale = MassScale;
+			Sphere->SetSimulatePhysics(true);
+			Sphere->RegisterComponent();
+
+			GravityManager->RegisterPositionQueryActor(Faller);
+			GravityManager->SetActorSignificant(Faller, true);
+
+			//The world ticks the manager as a tickable object, so the gravity it applies lands in the next frame's physics step
+			const double StartZ = Sphere->GetComponentLocation().Z;
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				World->Tick(LEVELTICK_All, TickDeltaTime);
+			}
+			Distance = StartZ - Sphere->GetComponentLocation().Z;
+		}
+
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		return Distance;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGravityFallParityTest, "GravPlugin.Physics.FallParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGravityFallParityTest::RunTest(const FString& Parameters)
+{
+	using namespace GravityFallParity;
+
+	//Gravity starts one frame late on every path, the first step runs before the manager has ticked
+	const double FallTime = (NumFrames - 1) * TickDeltaTime;
+	const double ExpectedDistance = 0.5 * ZoneGravity * FallTime * FallTime;
+
+	//A heavier body must fall the same distance, the mass scale is already part of the body mass
+	for (const float MassScale : { 1.f, 4.f })
+	{
+		const double GroupDistance = MeasureFall(EGravityPath::GravityGroup, MassScale);
+		TestTrue(FString::Printf(TEXT("The gravity group path fell %.1f cm at mass scale %.0f, expected about %.1f cm"), GroupDistance, MassScale, ExpectedDistance),
+			FMath::IsNearlyEqual(GroupDistance, ExpectedDistance, ExpectedDistance * 0.05));
+
+		//The game thread and substep force paths have to match the solver's own integration
+		for (const EGravityPath Path : { EGravityPath::Force, EGravityPath::Substep })
+		{
+			const double Distance = MeasureFall(Path, MassScale);
+			TestTrue(FString::Printf(TEXT("The %s path fell %.1f cm and the gravity group path %.1f cm at mass scale %.0f"), GetPathName(Path), Distance, GroupDistance, MassScale),
+				FMath::IsNearlyEqual(Distance, GroupDistance, ExpectedDistance * 0.01));
+		}
+	}
+	return true;
+}
+
+#endif
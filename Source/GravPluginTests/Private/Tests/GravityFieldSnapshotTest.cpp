@@ -0,0 +1,85 @@
+// --- GravityFieldSnapshotTest.cpp ---
+#include "GravityFieldSnapshot.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGravityFieldSnapshotHierarchyTest, "GravPlugin.FieldSnapshot.BoundsHierarchy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGravityFieldSnapshotHierarchyTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumZones = 300;
+	constexpr int32 NumPositions = 5000;
+	constexpr double HalfExtent = 20000.0;
+
+	//Overlapping boxes and spheres of mixed size and priority, plus a zone without a shape that must never match
+	FRandomStream Random(NumZones);
+	FGravityFieldSnapshot Snapshot;
+	for (int32 ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+	{
+		FGravityFieldSnapshot::FZone& Zone = Snapshot.Zones.AddDefaulted_GetRef();
+		Zone.Field.Type = EGravityFieldType::Uniform;
+		Zone.Field.BaseVector = Random.GetUnitVector() * Random.FRandRange(100.0, 2000.0);
+		Zone.Priority = Random.RandRange(0, 2);
+		Zone.LinearDamping = Random.FRandRange(0.f, 1.f);
+		Zone.AngularDamping = Random.FRandRange(0.f, 1.f);
+		Zone.FirstVolume = Snapshot.Volumes.Num();
+		if (ZoneIndex == 0) continue;
+
+		FGravityZoneVolume& Volume = Snapshot.Volumes.AddDefaulted_GetRef();
+		Volume.Shape = ZoneIndex % 2 ? FGravityZoneVolume::EShape::Sphere : FGravityZoneVolume::EShape::Box;
+		Volume.Center = FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent));
+		Volume.Rotation = FRotator(Random.FRandRange(0.0, 360.0), Random.FRandRange(0.0, 360.0), 0.0).Quaternion();
+		Volume.Extent = FVector(Random.FRandRange(500.0, ZoneIndex % 10 ? 4000.0 : 20000.0));
+		Zone.Bounds = Volume.GetBounds();
+		Zone.NumVolumes = 1;
+	}
+	Snapshot.BuildBoundsHierarchy();
+
+	TArray<FVector> Positions;
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		Positions.Add(FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent)));
+	}
+	TArray<FVector> Gravity;
+	TArray<FVector2f> Damping;
+	Gravity.SetNumUninitialized(NumPositions);
+	Damping.SetNumUninitialized(NumPositions);
+	FGravityFieldSnapshot::FBatchScratch Scratch;
+	Snapshot.SampleBatch(Positions, Gravity, Damping, Scratch);
+
+	//Reference result from testing every zone against every position
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		int32 HighestPriority = -INT_MAX;
+		FVector ExpectedGravity = FVector::ZeroVector;
+		FVector2f ExpectedDamping = FVector2f::ZeroVector;
+		for (int32 ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+		{
+			if (!Snapshot.ZoneContains(ZoneIndex, Positions[Index])) continue;
+			const FGravityFieldSnapshot::FZone& Zone = Snapshot.Zones[ZoneIndex];
+			ExpectedDamping.X = FMath::Max(ExpectedDamping.X, Zone.LinearDamping);
+			ExpectedDamping.Y = FMath::Max(ExpectedDamping.Y, Zone.AngularDamping);
+			if (Zone.Priority > HighestPriority)
+			{
+				HighestPriority = Zone.Priority;
+				ExpectedGravity = FVector::ZeroVector;
+			}
+			if (Zone.Priority == HighestPriority)
+			{
+				ExpectedGravity += Zone.Field.Evaluate(Positions[Index]);
+			}
+		}
+		if (!Gravity[Index].Equals(ExpectedGravity, 1.e-6) || !Damping[Index].Equals(ExpectedDamping, 0.f))
+		{
+			NumMismatches++;
+		}
+	}
+	TestEqual(TEXT("Positions sampled differently through the bounds hierarchy than against every zone"), NumMismatches, 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,97 @@
+// --- GravityKernelBenchmark.cpp ---
+#include "GravPluginLibrary/GravityKernel.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace GravKernel;
+
+//Usage: GravityKernelBenchmark [NumPositions] [Iterations]
+int main(int Argc, char** Argv)
+{
+	const int32_t Num = Argc > 1 ? std::atoi(Argv[1]) : 4096;
+	const int32_t Iterations = Argc > 2 ? std::atoi(Argv[2]) : 2000;
+	if (Num <= 0 || Iterations <= 0) return 1;
+
+	std::mt19937_64 Random(42);
+	std::uniform_real_distribution<double> Coordinate(-5000.0, 5000.0);
+	std::vector<double> X(Num), Y(Num), Z(Num), LanePriority(Num, 0.0);
+	std::vector<double> OutX(Num), OutY(Num), OutZ(Num);
+	for (int32_t Index = 0; Index < Num; ++Index)
+	{
+		X[Index] = Coordinate(Random);
+		Y[Index] = Coordinate(Random);
+		Z[Index] = Coordinate(Random);
+	}
+
+	//Sum of every output, printed so none of the work can be optimized away
+	double Checksum = 0.0;
+
+	using FClock = std::chrono::steady_clock;
+	auto Measure = [&](auto&& Body)
+	{
+		Body(); //Warm the caches
+		const FClock::time_point Start = FClock::now();
+		for (int32_t Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Body();
+			Checksum += OutX[Iteration % Num] + OutY[0] + OutZ[Num - 1];
+		}
+		const double Nanoseconds = double(std::chrono::duration_cast<std::chrono::nanoseconds>(FClock::now() - Start).count());
+		return Nanoseconds / (double(Num) * double(Iterations));
+	};
+
+	struct FCase
+	{
+		const char* Name;
+		EFieldType Type;
+		double FalloffExponent;
+	};
+	const FCase Cases[] =
+	{
+		{ "Uniform", EFieldType::Uniform, 0.0 },
+		{ "Radial 1/r^2", EFieldType::Radial, 2.0 },
+		{ "Radial 1/r", EFieldType::Radial, 1.0 },
+		{ "Radial 1/r^1.5", EFieldType::Radial, 1.5 },
+		{ "Cylindrical 1/r^2", EFieldType::Cylindrical, 2.0 },
+		{ "Planar const", EFieldType::Planar, 0.0 },
+	};
+
+	std::printf("GravityKernelBenchmark: %d positions x %d iterations, vector path %s (%d lanes)\n", Num, Iterations, GetVectorPathName(), GetVectorPathWidth());
+	std::printf("%-20s %12s %12s %12s %9s\n", "Field", "Scalar ns", "Batch1 ns", "SIMD ns", "Speedup");
+	for (const FCase& Case : Cases)
+	{
+		FFieldParams Field;
+		Field.Type = Case.Type;
+		Field.Origin = { 10.0, 20.0, 30.0 };
+		Field.Axis = { 0.0, 0.6, 0.8 };
+		Field.Radius = 500.0;
+		Field.FalloffExponent = Case.FalloffExponent;
+
+		//Per position calls, batch without vectors, and the batch the manager uses
+		const double Scalar = Measure([&]()
+		{
+			for (int32_t Index = 0; Index < Num; ++Index)
+			{
+				const FVec3 Gravity = Evaluate(Field, { X[Index], Y[Index], Z[Index] });
+				OutX[Index] = Gravity.X;
+				OutY[Index] = Gravity.Y;
+				OutZ[Index] = Gravity.Z;
+			}
+		});
+		const double BatchScalar = Measure([&]()
+		{
+			EvaluateBatchScalar(Field, 0, X.data(), Y.data(), Z.data(), LanePriority.data(), OutX.data(), OutY.data(), OutZ.data(), Num);
+		});
+		const double Batch = Measure([&]()
+		{
+			EvaluateBatch(Field, 0, X.data(), Y.data(), Z.data(), LanePriority.data(), OutX.data(), OutY.data(), OutZ.data(), Num);
+		});
+		std::printf("%-20s %12.3f %12.3f %12.3f %8.2fx\n", Case.Name, Scalar, BatchScalar, Batch, BatchScalar / Batch);
+	}
+	std::printf("Checksum %g\n", Checksum);
+	return 0;
+}
@@ -1,6 +1,5 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
-using System.IO;
 using UnrealBuildTool;
 
 public class GravPluginLibrary : ModuleRules
@@ -8,30 +7,12 @@ public class GravPluginLibrary : ModuleRules
 	public GravPluginLibrary(ReadOnlyTargetRules Target) : base(Target)
 	{
 		Type = ModuleType.External;
-		PublicSystemIncludePaths.Add("$(ModuleDir)/Public");
-
-		if (Target.Platform == UnrealTargetPlatform.Win64)
-		{
-			// Add the import library
-			///PublicAdditionalLibraries.Add(Path.Combine(ModuleDirectory, "x64", "Release", "ExampleLibrary.lib"));
 
-			// Delay-load the DLL, so we can load it from the right place first
-			//PublicDelayLoadDLLs.Add("ExampleLibrary.dll");
+		// Header only gravity kernel, nothing to link or stage. The same headers build standalone through CMakeLists.txt
+		// next to this file for the unit tests and microbenchmark
+		PublicSystemIncludePaths.Add("$(ModuleDir)/Public");
 
-			// Ensure that the DLL is staged along with the executable
-			//RuntimeDependencies.Add("$(PluginDir)/Binaries/ThirdParty/GravPluginLibrary/Win64/ExampleLibrary.dll");
-		}
-		else if (Target.Platform == UnrealTargetPlatform.Mac)
-		{
-			//PublicDelayLoadDLLs.Add(Path.Combine(ModuleDirectory, "Mac", "Release", "libExampleLibrary.dylib"));
-			//RuntimeDependencies.Add("$(PluginDir)/Source/ThirdParty/GravPluginLibrary/Mac/Release/libExampleLibrary.dylib");
-		}
-		else if (Target.Platform == UnrealTargetPlatform.Linux)
-		{
-			string ExampleSoPath = Path.Combine("$(PluginDir)", "Binaries", "ThirdParty", "GravPluginLibrary", "Linux", "x86_64-unknown-linux-gnu", "libExampleLibrary.so");
-			//PublicAdditionalLibraries.Add(ExampleSoPath);
-			//PublicDelayLoadDLLs.Add(ExampleSoPath);
-			//RuntimeDependencies.Add(ExampleSoPath);
-		}
+		// Inside the engine the batch path runs on VectorRegister4Double, which already maps to AVX, SSE or NEON per platform
+		PublicDefinitions.Add("GRAVKERNEL_UE_VECTORS=1");
 	}
 }
@@ -1,9 +0,0 @@
-#if defined _WIN32 || defined _WIN64
-#define EXAMPLELIBRARY_IMPORT __declspec(dllimport)
-#elif defined __linux__
-#define EXAMPLELIBRARY_IMPORT __attribute__((visibility("default")))
-#else
-#define EXAMPLELIBRARY_IMPORT
-#endif
-
-EXAMPLELIBRARY_IMPORT void ExampleLibraryFunction();
@@ -0,0 +1,400 @@
+// --- GravityKernel.h ---
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Vector path for EvaluateBatch, the scalar path always exists for the remainder lanes. Inside the engine the
+// plugin's Build.cs defines GRAVKERNEL_UE_VECTORS, so batches run four lanes wide on VectorRegister4Double and take
+// whatever the target platform maps it to (AVX, paired SSE2 or paired NEON registers). Standalone builds use the
+// widest intrinsics the compiler was allowed: AVX at four lanes, SSE2 or NEON at two
+#if defined(GRAVKERNEL_UE_VECTORS) && GRAVKERNEL_UE_VECTORS
+	#include "Math/VectorRegister.h"
+	#define GRAVKERNEL_VECTORS 1
+#elif defined(__AVX__)
+	#include <immintrin.h>
+	#define GRAVKERNEL_AVX 1
+	#define GRAVKERNEL_VECTORS 1
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#include <emmintrin.h>
+	#define GRAVKERNEL_SSE2 1
+	#define GRAVKERNEL_VECTORS 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define GRAVKERNEL_NEON 1
+	#define GRAVKERNEL_VECTORS 1
+#else
+	#define GRAVKERNEL_VECTORS 0
+#endif
+
+/**
+ * Engine free gravity field math shared by the plugin, its tests and its microbenchmark. Covers the analytic zone
+ * fields with their falloff, batched evaluation over structure-of-arrays positions, and the zone priority rule:
+ * ResolvePriorities hands each lane the highest priority of its entity's zones, and the batch masks lanes owned by a
+ * higher priority zone than the one being evaluated. Also holds the octahedral direction encoding replicated gravity
+ * is sent with.
+ */
+namespace GravKernel
+{
+	constexpr double KindaSmallNumber = 1.e-4;
+	constexpr double LowestPriority = -2147483647.0; //Below every zone priority, the priority of an entity in no zone
+
+	enum class EFieldType : uint8_t
+	{
+		Uniform,
+		Radial,
+		Cylindrical,
+		Planar
+	};
+
+	struct FVec3
+	{
+		double X = 0.0;
+		double Y = 0.0;
+		double Z = 0.0;
+	};
+
+	struct FFieldParams
+	{
+		EFieldType Type = EFieldType::Uniform;
+		FVec3 BaseVector = { 0.0, 0.0, -980.0 }; //Used directly by uniform fields
+		FVec3 Origin;                            //Field center
+		FVec3 Axis = { 0.0, 0.0, 1.0 };          //Unit axis used by cylindrical and planar fields
+		double Strength = 980.0;                 //Acceleration at or inside Radius
+		double Radius = 100.0;                   //Distance at which falloff starts
+		double FalloffExponent = 2.0;            //0 = constant, 2 = inverse square
+	};
+
+	//Field magnitude at a distance from the origin, axis or plane
+	inline double GetFalloffStrength(const FFieldParams& Field, double Distance)
+	{
+		if (Distance <= Field.Radius || Field.FalloffExponent == 0.0)
+		{
+			return Field.Strength;
+		}
+		const double Ratio = Field.Radius / Distance;
+		if (Field.FalloffExponent == 2.0)
+		{
+			return Field.Strength * Ratio * Ratio;
+		}
+		if (Field.FalloffExponent == 1.0)
+		{
+			return Field.Strength * Ratio;
+		}
+		return Field.Strength * std::pow(Ratio, Field.FalloffExponent);
+	}
+
+	//Gravity at a position
+	inline FVec3 Evaluate(const FFieldParams& Field, const FVec3& Position)
+	{
+		FVec3 ToField;
+		switch (Field.Type)
+		{
+		case EFieldType::Radial:
+			ToField = { Field.Origin.X - Position.X, Field.Origin.Y - Position.Y, Field.Origin.Z - Position.Z };
+			break;
+		case EFieldType::Cylindrical:
+		case EFieldType::Planar:
+		{
+			const FVec3 Offset = { Position.X - Field.Origin.X, Position.Y - Field.Origin.Y, Position.Z - Field.Origin.Z };
+			const double Along = Offset.X * Field.Axis.X + Offset.Y * Field.Axis.Y + Offset.Z * Field.Axis.Z;
+			ToField = Field.Type == EFieldType::Cylindrical
+				? FVec3{ Field.Axis.X * Along - Offset.X, Field.Axis.Y * Along - Offset.Y, Field.Axis.Z * Along - Offset.Z }
+				: FVec3{ Field.Axis.X * -Along, Field.Axis.Y * -Along, Field.Axis.Z * -Along };
+			break;
+		}
+		default:
+			return Field.BaseVector;
+		}
+
+		const double Distance = std::sqrt(ToField.X * ToField.X + ToField.Y * ToField.Y + ToField.Z * ToField.Z);
+		if (Distance <= KindaSmallNumber)
+		{
+			return FVec3();
+		}
+		const double Scale = GetFalloffStrength(Field, Distance) / Distance;
+		return { ToField.X * Scale, ToField.Y * Scale, ToField.Z * Scale };
+	}
+
+	//One lane at a time, the reference the vector path is tested against
+	inline void EvaluateBatchScalar(const FFieldParams& Field, int32_t Priority, const double* X, const double* Y, const double* Z, const double* LanePriority,
+		double* OutX, double* OutY, double* OutZ, int32_t Num)
+	{
+		for (int32_t Index = 0; Index < Num; ++Index)
+		{
+			const FVec3 Gravity = !LanePriority || LanePriority[Index] <= double(Priority) ? Evaluate(Field, { X[Index], Y[Index], Z[Index] }) : FVec3();
+			OutX[Index] = Gravity.X;
+			OutY[Index] = Gravity.Y;
+			OutZ[Index] = Gravity.Z;
+		}
+	}
+
+	//Only the common exponents have an exact vector form, anything else goes through the scalar path
+	inline bool HasVectorPath(const FFieldParams& Field)
+	{
+		return Field.Type == EFieldType::Uniform || Field.FalloffExponent == 0.0 || Field.FalloffExponent == 1.0 || Field.FalloffExponent == 2.0;
+	}
+
+	namespace Simd
+	{
+#if defined(GRAVKERNEL_UE_VECTORS) && GRAVKERNEL_UE_VECTORS
+		//Engine vector layer, the same four lane path the plugin used before the kernel moved here
+		struct FLanes
+		{
+			using FReg = VectorRegister4Double;
+			static constexpr int32_t Num = 4;
+			static constexpr const char* Name = "VectorRegister4Double";
+			static FReg Load(const double* Ptr) { return VectorLoad(Ptr); }
+			static void Store(const FReg& Value, double* Ptr) { VectorStore(Value, Ptr); }
+			static FReg Set(double Value) { return VectorSetFloat1(Value); }
+			static FReg Zero() { return VectorZeroDouble(); }
+			static FReg Add(const FReg& A, const FReg& B) { return VectorAdd(A, B); }
+			static FReg Sub(const FReg& A, const FReg& B) { return VectorSubtract(A, B); }
+			static FReg Mul(const FReg& A, const FReg& B) { return VectorMultiply(A, B); }
+			static FReg Div(const FReg& A, const FReg& B) { return VectorDivide(A, B); }
+			static FReg Sqrt(const FReg& A) { return VectorSqrt(A); }
+			static FReg CompareLE(const FReg& A, const FReg& B) { return VectorCompareLE(A, B); }
+			static FReg Select(const FReg& Mask, const FReg& IfTrue, const FReg& IfFalse) { return VectorSelect(Mask, IfTrue, IfFalse); }
+		};
+#elif defined(GRAVKERNEL_AVX)
+		struct FLanes
+		{
+			using FReg = __m256d;
+			static constexpr int32_t Num = 4;
+			static constexpr const char* Name = "AVX";
+			static FReg Load(const double* Ptr) { return _mm256_loadu_pd(Ptr); }
+			static void Store(FReg Value, double* Ptr) { _mm256_storeu_pd(Ptr, Value); }
+			static FReg Set(double Value) { return _mm256_set1_pd(Value); }
+			static FReg Zero() { return _mm256_setzero_pd(); }
+			static FReg Add(FReg A, FReg B) { return _mm256_add_pd(A, B); }
+			static FReg Sub(FReg A, FReg B) { return _mm256_sub_pd(A, B); }
+			static FReg Mul(FReg A, FReg B) { return _mm256_mul_pd(A, B); }
+			static FReg Div(FReg A, FReg B) { return _mm256_div_pd(A, B); }
+			static FReg Sqrt(FReg A) { return _mm256_sqrt_pd(A); }
+			static FReg CompareLE(FReg A, FReg B) { return _mm256_cmp_pd(A, B, _CMP_LE_OQ); }
+			static FReg Select(FReg Mask, FReg IfTrue, FReg IfFalse) { return _mm256_blendv_pd(IfFalse, IfTrue, Mask); }
+		};
+#elif defined(GRAVKERNEL_SSE2)
+		struct FLanes
+		{
+			using FReg = __m128d;
+			static constexpr int32_t Num = 2;
+			static constexpr const char* Name = "SSE2";
+			static FReg Load(const double* Ptr) { return _mm_loadu_pd(Ptr); }
+			static void Store(FReg Value, double* Ptr) { _mm_storeu_pd(Ptr, Value); }
+			static FReg Set(double Value) { return _mm_set1_pd(Value); }
+			static FReg Zero() { return _mm_setzero_pd(); }
+			static FReg Add(FReg A, FReg B) { return _mm_add_pd(A, B); }
+			static FReg Sub(FReg A, FReg B) { return _mm_sub_pd(A, B); }
+			static FReg Mul(FReg A, FReg B) { return _mm_mul_pd(A, B); }
+			static FReg Div(FReg A, FReg B) { return _mm_div_pd(A, B); }
+			static FReg Sqrt(FReg A) { return _mm_sqrt_pd(A); }
+			static FReg CompareLE(FReg A, FReg B) { return _mm_cmple_pd(A, B); }
+			static FReg Select(FReg Mask, FReg IfTrue, FReg IfFalse) { return _mm_or_pd(_mm_and_pd(Mask, IfTrue), _mm_andnot_pd(Mask, IfFalse)); }
+		};
+#elif defined(GRAVKERNEL_NEON)
+		struct FLanes
+		{
+			using FReg = float64x2_t;
+			static constexpr int32_t Num = 2;
+			static constexpr const char* Name = "NEON";
+			static FReg Load(const double* Ptr) { return vld1q_f64(Ptr); }
+			static void Store(FReg Value, double* Ptr) { vst1q_f64(Ptr, Value); }
+			static FReg Set(double Value) { return vdupq_n_f64(Value); }
+			static FReg Zero() { return vdupq_n_f64(0.0); }
+			static FReg Add(FReg A, FReg B) { return vaddq_f64(A, B); }
+			static FReg Sub(FReg A, FReg B) { return vsubq_f64(A, B); }
+			static FReg Mul(FReg A, FReg B) { return vmulq_f64(A, B); }
+			static FReg Div(FReg A, FReg B) { return vdivq_f64(A, B); }
+			static FReg Sqrt(FReg A) { return vsqrtq_f64(A); }
+			static FReg CompareLE(FReg A, FReg B) { return vreinterpretq_f64_u64(vcleq_f64(A, B)); }
+			static FReg Select(FReg Mask, FReg IfTrue, FReg IfFalse) { return vbslq_f64(vreinterpretq_u64_f64(Mask), IfTrue, IfFalse); }
+		};
+#endif
+
+#if GRAVKERNEL_VECTORS
+		//Processes whole vectors and returns the number of lanes handled, the caller finishes the rest
+		inline int32_t EvaluateBatch(const FFieldParams& Field, int32_t Priority, const double* X, const double* Y, const double* Z, const double* LanePriority,
+			double* OutX, double* OutY, double* OutZ, int32_t Num)
+		{
+			using V = FLanes;
+			using FReg = V::FReg;
+
+			const FReg Zero = V::Zero();
+			const FReg ZonePriority = V::Set(double(Priority));
+			const FReg Strength = V::Set(Field.Strength);
+			const FReg Radius = V::Set(Field.Radius);
+			const FReg Small = V::Set(KindaSmallNumber);
+			const FReg AllLanes = V::CompareLE(Zero, Zero);
+			const FReg OX = V::Set(Field.Origin.X), OY = V::Set(Field.Origin.Y), OZ = V::Set(Field.Origin.Z);
+			const FReg AX = V::Set(Field.Axis.X), AY = V::Set(Field.Axis.Y), AZ = V::Set(Field.Axis.Z);
+
+			int32_t Index = 0;
+			for (; Index + V::Num <= Num; Index += V::Num)
+			{
+				//Lanes owned by a higher priority zone are masked to zero
+				const FReg Active = LanePriority ? V::CompareLE(V::Load(LanePriority + Index), ZonePriority) : AllLanes;
+
+				FReg GX, GY, GZ;
+				if (Field.Type == EFieldType::Uniform)
+				{
+					GX = V::Set(Field.BaseVector.X);
+					GY = V::Set(Field.BaseVector.Y);
+					GZ = V::Set(Field.BaseVector.Z);
+				}
+				else
+				{
+					//Vector from each lane to the closest point of the origin, axis or plane
+					const FReg PX = V::Load(X + Index), PY = V::Load(Y + Index), PZ = V::Load(Z + Index);
+					FReg TX, TY, TZ;
+					if (Field.Type == EFieldType::Radial)
+					{
+						TX = V::Sub(OX, PX);
+						TY = V::Sub(OY, PY);
+						TZ = V::Sub(OZ, PZ);
+					}
+					else
+					{
+						const FReg DX = V::Sub(PX, OX), DY = V::Sub(PY, OY), DZ = V::Sub(PZ, OZ);
+						const FReg Along = V::Add(V::Add(V::Mul(DX, AX), V::Mul(DY, AY)), V::Mul(DZ, AZ));
+						if (Field.Type == EFieldType::Cylindrical)
+						{
+							TX = V::Sub(V::Mul(AX, Along), DX);
+							TY = V::Sub(V::Mul(AY, Along), DY);
+							TZ = V::Sub(V::Mul(AZ, Along), DZ);
+						}
+						else
+						{
+							const FReg NegAlong = V::Sub(Zero, Along);
+							TX = V::Mul(AX, NegAlong);
+							TY = V::Mul(AY, NegAlong);
+							TZ = V::Mul(AZ, NegAlong);
+						}
+					}
+					const FReg Distance = V::Sqrt(V::Add(V::Add(V::Mul(TX, TX), V::Mul(TY, TY)), V::Mul(TZ, TZ)));
+
+					FReg Falloff = Strength;
+					if (Field.FalloffExponent != 0.0)
+					{
+						const FReg Ratio = V::Div(Radius, Distance);
+						FReg Scaled = V::Mul(Strength, Ratio);
+						if (Field.FalloffExponent == 2.0)
+						{
+							Scaled = V::Mul(Scaled, Ratio);
+						}
+						Falloff = V::Select(V::CompareLE(Distance, Radius), Strength, Scaled);
+					}
+
+					//Positions sitting on the feature have no defined direction and get no gravity
+					const FReg Scale = V::Select(V::CompareLE(Distance, Small), Zero, V::Div(Falloff, Distance));
+					GX = V::Mul(TX, Scale);
+					GY = V::Mul(TY, Scale);
+					GZ = V::Mul(TZ, Scale);
+				}
+
+				V::Store(V::Select(Active, GX, Zero), OutX + Index);
+				V::Store(V::Select(Active, GY, Zero), OutY + Index);
+				V::Store(V::Select(Active, GZ, Zero), OutZ + Index);
+			}
+			return Index;
+		}
+#endif
+	}
+
+	// --- Direction Encoding ---
+	//Sign with zero counted as positive, so the octahedral fold sends every point of the lower half to a quadrant
+	inline double SignNotZero(double Value)
+	{
+		return Value >= 0.0 ? 1.0 : -1.0;
+	}
+
+	//Packs a unit direction into two 16 bit octahedral coordinates. The error stays even across the sphere, unlike
+	//packing two angles
+	inline uint32_t PackOctahedral(const FVec3& Direction)
+	{
+		const double L1 = std::fabs(Direction.X) + std::fabs(Direction.Y) + std::fabs(Direction.Z);
+		double OctX = Direction.X / L1;
+		double OctY = Direction.Y / L1;
+		if (Direction.Z < 0.0)
+		{
+			const double FoldX = (1.0 - std::fabs(OctY)) * SignNotZero(OctX);
+			const double FoldY = (1.0 - std::fabs(OctX)) * SignNotZero(OctY);
+			OctX = FoldX;
+			OctY = FoldY;
+		}
+		const uint32_t X = uint32_t(std::lround((OctX * 0.5 + 0.5) * 65535.0));
+		const uint32_t Y = uint32_t(std::lround((OctY * 0.5 + 0.5) * 65535.0));
+		return X | (Y << 16);
+	}
+
+	//Unit direction from PackOctahedral
+	inline FVec3 UnpackOctahedral(uint32_t Packed)
+	{
+		const double X = double(Packed & 0xFFFF) / 65535.0 * 2.0 - 1.0;
+		const double Y = double(Packed >> 16) / 65535.0 * 2.0 - 1.0;
+		FVec3 Direction = { X, Y, 1.0 - std::fabs(X) - std::fabs(Y) };
+		if (Direction.Z < 0.0)
+		{
+			Direction.X = (1.0 - std::fabs(Y)) * SignNotZero(X);
+			Direction.Y = (1.0 - std::fabs(X)) * SignNotZero(Y);
+		}
+		const double Length = std::sqrt(Direction.X * Direction.X + Direction.Y * Direction.Y + Direction.Z * Direction.Z);
+		return { Direction.X / Length, Direction.Y / Length, Direction.Z / Length };
+	}
+
+	// --- Priority Resolution ---
+	//The rule every caller shares: an entity only takes gravity from the zones at its highest priority, and sums them.
+	//Each lane pairs an entity with one zone it is in. LanePriority holds that zone's priority on input and the entity's
+	//highest priority on output, so EvaluateBatch then zeroes the lanes of every lower priority zone and summing an
+	//entity's lanes gives its gravity. EntityPriority is indexed by LaneEntity and seeded by the caller, with
+	//LowestPriority or the priority of anything else that can outrank the zones
+	inline void ResolvePriorities(const int32_t* LaneEntity, double* LanePriority, double* EntityPriority, int32_t NumLanes)
+	{
+		for (int32_t Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			double& Priority = EntityPriority[LaneEntity[Lane]];
+			Priority = LanePriority[Lane] > Priority ? LanePriority[Lane] : Priority;
+		}
+		for (int32_t Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			LanePriority[Lane] = EntityPriority[LaneEntity[Lane]];
+		}
+	}
+
+	//Name of the vector path EvaluateBatch takes in this build
+	inline const char* GetVectorPathName()
+	{
+#if GRAVKERNEL_VECTORS
+		return Simd::FLanes::Name;
+#else
+		return "Scalar";
+#endif
+	}
+
+	//Positions the vector path evaluates at once, 1 without one
+	inline int32_t GetVectorPathWidth()
+	{
+#if GRAVKERNEL_VECTORS
+		return Simd::FLanes::Num;
+#else
+		return 1;
+#endif
+	}
+
+	//Evaluates Num positions stored as separate X, Y and Z arrays, several lanes at a time. Lanes whose
+	//LanePriority is above Priority belong to a higher priority zone and receive a zero vector, a null
+	//LanePriority evaluates every lane
+	inline void EvaluateBatch(const FFieldParams& Field, int32_t Priority, const double* X, const double* Y, const double* Z, const double* LanePriority,
+		double* OutX, double* OutY, double* OutZ, int32_t Num)
+	{
+		int32_t Index = 0;
+#if GRAVKERNEL_VECTORS
+		if (HasVectorPath(Field))
+		{
+			Index = Simd::EvaluateBatch(Field, Priority, X, Y, Z, LanePriority, OutX, OutY, OutZ, Num);
+		}
+#endif
+		EvaluateBatchScalar(Field, Priority, X + Index, Y + Index, Z + Index, LanePriority ? LanePriority + Index : nullptr, OutX + Index, OutY + Index, OutZ + Index, Num - Index);
+	}
+}
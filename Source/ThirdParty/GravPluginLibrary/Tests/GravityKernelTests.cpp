@@ -0,0 +1,333 @@
+// --- GravityKernelTests.cpp ---
+#include "GravPluginLibrary/GravityKernel.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace GravKernel;
+
+static int GFailures = 0;
+
+#define CHECK_NEAR(Actual, Expected, Tolerance) \
+	do { \
+		const double A = (Actual), E = (Expected); \
+		if (!(std::fabs(A - E) <= (Tolerance))) \
+		{ \
+			std::printf("%s:%d: %s = %.9g, expected %.9g\n", __FILE__, __LINE__, #Actual, A, E); \
+			++GFailures; \
+		} \
+	} while (0)
+
+static void CheckVec(const FVec3& Actual, const FVec3& Expected, double Tolerance = 1.e-9)
+{
+	CHECK_NEAR(Actual.X, Expected.X, Tolerance);
+	CHECK_NEAR(Actual.Y, Expected.Y, Tolerance);
+	CHECK_NEAR(Actual.Z, Expected.Z, Tolerance);
+}
+
+static FFieldParams MakeField(EFieldType Type, double FalloffExponent)
+{
+	FFieldParams Field;
+	Field.Type = Type;
+	Field.BaseVector = { 10.0, -20.0, -980.0 };
+	Field.Origin = { 100.0, -50.0, 25.0 };
+	Field.Axis = { 0.0, 0.6, 0.8 };
+	Field.Strength = 500.0;
+	Field.Radius = 200.0;
+	Field.FalloffExponent = FalloffExponent;
+	return Field;
+}
+
+// --- Scalar ---
+static void TestUniform()
+{
+	const FFieldParams Field = MakeField(EFieldType::Uniform, 2.0);
+	CheckVec(Evaluate(Field, { 1.e6, -3.0, 7.0 }), Field.BaseVector);
+}
+
+static void TestRadial()
+{
+	FFieldParams Field = MakeField(EFieldType::Radial, 2.0);
+	Field.Origin = {};
+
+	//Full strength towards the origin inside the radius
+	CheckVec(Evaluate(Field, { 100.0, 0.0, 0.0 }), { -500.0, 0.0, 0.0 });
+
+	//Inverse square past it
+	CheckVec(Evaluate(Field, { 0.0, 400.0, 0.0 }), { 0.0, -125.0, 0.0 });
+
+	Field.FalloffExponent = 1.0;
+	CheckVec(Evaluate(Field, { 0.0, 0.0, -400.0 }), { 0.0, 0.0, 250.0 });
+
+	Field.FalloffExponent = 0.0;
+	CheckVec(Evaluate(Field, { 0.0, 0.0, -4000.0 }), { 0.0, 0.0, 500.0 });
+
+	Field.FalloffExponent = 3.0;
+	CHECK_NEAR(GetFalloffStrength(Field, 400.0), 62.5, 1.e-9);
+
+	//No direction at the origin itself
+	CheckVec(Evaluate(Field, {}), {});
+}
+
+static void TestCylindrical()
+{
+	FFieldParams Field = MakeField(EFieldType::Cylindrical, 2.0);
+	Field.Origin = {};
+	Field.Axis = { 0.0, 0.0, 1.0 };
+
+	//Pulled towards the axis, the offset along it does not matter
+	CheckVec(Evaluate(Field, { 400.0, 0.0, 1234.0 }), { -125.0, 0.0, 0.0 });
+	CheckVec(Evaluate(Field, { 0.0, 0.0, 50.0 }), {});
+}
+
+static void TestPlanar()
+{
+	FFieldParams Field = MakeField(EFieldType::Planar, 0.0);
+	Field.Origin = {};
+	Field.Axis = { 0.0, 0.0, 1.0 };
+
+	//Pulled onto the plane from either side, sliding along it changes nothing
+	CheckVec(Evaluate(Field, { 999.0, -5.0, 10.0 }), { 0.0, 0.0, -500.0 });
+	CheckVec(Evaluate(Field, { -3.0, 42.0, -10.0 }), { 0.0, 0.0, 500.0 });
+}
+
+// --- Batch ---
+static void TestBatchMatchesScalar()
+{
+	std::mt19937_64 Random(1234);
+	std::uniform_real_distribution<double> Coordinate(-2000.0, 2000.0);
+
+	//Odd count so every vector width leaves a remainder
+	const int32_t Num = 37;
+	std::vector<double> X(Num), Y(Num), Z(Num), LanePriority(Num, -1.0);
+	std::vector<double> OutX(Num), OutY(Num), OutZ(Num);
+	for (int32_t Index = 0; Index < Num; ++Index)
+	{
+		X[Index] = Coordinate(Random);
+		Y[Index] = Coordinate(Random);
+		Z[Index] = Coordinate(Random);
+	}
+	X[5] = 100.0; Y[5] = -50.0; Z[5] = 25.0; //Exactly on the origin
+
+	for (EFieldType Type : { EFieldType::Uniform, EFieldType::Radial, EFieldType::Cylindrical, EFieldType::Planar })
+	{
+		for (double Exponent : { 0.0, 1.0, 2.0, 1.5 })
+		{
+			const FFieldParams Field = MakeField(Type, Exponent);
+			EvaluateBatch(Field, 0, X.data(), Y.data(), Z.data(), LanePriority.data(), OutX.data(), OutY.data(), OutZ.data(), Num);
+			for (int32_t Index = 0; Index < Num; ++Index)
+			{
+				CheckVec({ OutX[Index], OutY[Index], OutZ[Index] }, Evaluate(Field, { X[Index], Y[Index], Z[Index] }), 1.e-9);
+			}
+
+			//Without a lane priority nothing is masked
+			EvaluateBatch(Field, -5, X.data(), Y.data(), Z.data(), nullptr, OutX.data(), OutY.data(), OutZ.data(), Num);
+			for (int32_t Index = 0; Index < Num; ++Index)
+			{
+				CheckVec({ OutX[Index], OutY[Index], OutZ[Index] }, Evaluate(Field, { X[Index], Y[Index], Z[Index] }), 1.e-9);
+			}
+		}
+	}
+}
+
+static void TestBatchPriorityMask()
+{
+	const int32_t Num = 9;
+	std::vector<double> X(Num, 0.0), Y(Num, 0.0), Z(Num, 500.0), LanePriority(Num);
+	std::vector<double> OutX(Num), OutY(Num), OutZ(Num);
+	for (int32_t Index = 0; Index < Num; ++Index)
+	{
+		LanePriority[Index] = Index % 3 == 0 ? 5.0 : 2.0;
+	}
+
+	FFieldParams Field = MakeField(EFieldType::Radial, 0.0);
+	Field.Origin = {};
+	EvaluateBatch(Field, 2, X.data(), Y.data(), Z.data(), LanePriority.data(), OutX.data(), OutY.data(), OutZ.data(), Num);
+	for (int32_t Index = 0; Index < Num; ++Index)
+	{
+		//Lanes resolved to a higher priority zone stay zero, the rest see this zone
+		CheckVec({ OutX[Index], OutY[Index], OutZ[Index] }, Index % 3 == 0 ? FVec3() : FVec3{ 0.0, 0.0, -500.0 });
+	}
+}
+
+// --- Priority Resolution ---
+static void TestResolvePriorities()
+{
+	//Entity 0 has two zones tied at the top, entity 2 is seeded below its zones and entity 3 above them, like a gravity source
+	std::vector<int32_t> LaneEntity = { 0, 0, 1, 2, 0, 2, 3 };
+	std::vector<double> LanePriority = { 1.0, 3.0, 0.0, 2.0, 3.0, 5.0, 2.0 };
+	std::vector<double> EntityPriority = { LowestPriority, LowestPriority, 4.0, 7.0 };
+	ResolvePriorities(LaneEntity.data(), LanePriority.data(), EntityPriority.data(), int32_t(LaneEntity.size()));
+
+	const std::vector<double> ExpectedLanes = { 3.0, 3.0, 0.0, 5.0, 3.0, 5.0, 7.0 };
+	for (size_t Lane = 0; Lane < ExpectedLanes.size(); ++Lane)
+	{
+		CHECK_NEAR(LanePriority[Lane], ExpectedLanes[Lane], 0.0);
+	}
+	const std::vector<double> ExpectedEntities = { 3.0, 0.0, 5.0, 7.0 };
+	for (size_t Entity = 0; Entity < ExpectedEntities.size(); ++Entity)
+	{
+		CHECK_NEAR(EntityPriority[Entity], ExpectedEntities[Entity], 0.0);
+	}
+}
+
+static void TestResolvedBatchSum()
+{
+	//Random zones and memberships, the batch result has to match summing each entity's highest priority zones one by one
+	std::mt19937 Random(7);
+	std::uniform_real_distribution<double> Coordinate(-1000.0, 1000.0);
+	std::uniform_int_distribution<int> PickPriority(0, 2);
+	std::uniform_int_distribution<int> PickType(0, 3);
+
+	const int32_t NumZones = 6;
+	const int32_t NumEntities = 53;
+	std::vector<FFieldParams> Fields;
+	std::vector<double> ZonePriority;
+	for (int32_t ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+	{
+		FFieldParams Field = MakeField(EFieldType(PickType(Random)), ZoneIndex % 3 == 0 ? 1.0 : 2.0);
+		Field.Origin = { Coordinate(Random), Coordinate(Random), Coordinate(Random) };
+		Fields.push_back(Field);
+		ZonePriority.push_back(double(PickPriority(Random)));
+	}
+
+	std::vector<FVec3> Positions(NumEntities);
+	std::vector<std::vector<int32_t>> EntityZones(NumEntities);
+	for (int32_t Entity = 0; Entity < NumEntities; ++Entity)
+	{
+		Positions[Entity] = { Coordinate(Random), Coordinate(Random), Coordinate(Random) };
+		for (int32_t ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+		{
+			if (Random() % 2)
+			{
+				EntityZones[Entity].push_back(ZoneIndex);
+			}
+		}
+	}
+
+	//Lanes laid out contiguously per zone, as both callers batch them
+	std::vector<int32_t> LaneEntity, ZoneStart(NumZones + 1, 0);
+	std::vector<double> X, Y, Z, LanePriority;
+	for (int32_t ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+	{
+		ZoneStart[ZoneIndex] = int32_t(LaneEntity.size());
+		for (int32_t Entity = 0; Entity < NumEntities; ++Entity)
+		{
+			for (int32_t EntityZone : EntityZones[Entity])
+			{
+				if (EntityZone != ZoneIndex) continue;
+				LaneEntity.push_back(Entity);
+				X.push_back(Positions[Entity].X);
+				Y.push_back(Positions[Entity].Y);
+				Z.push_back(Positions[Entity].Z);
+				LanePriority.push_back(ZonePriority[ZoneIndex]);
+			}
+		}
+	}
+	const int32_t NumLanes = int32_t(LaneEntity.size());
+	ZoneStart[NumZones] = NumLanes;
+
+	std::vector<double> EntityPriority(NumEntities, LowestPriority);
+	ResolvePriorities(LaneEntity.data(), LanePriority.data(), EntityPriority.data(), NumLanes);
+
+	std::vector<double> OutX(NumLanes), OutY(NumLanes), OutZ(NumLanes);
+	std::vector<FVec3> Batched(NumEntities);
+	for (int32_t ZoneIndex = 0; ZoneIndex < NumZones; ++ZoneIndex)
+	{
+		const int32_t Start = ZoneStart[ZoneIndex];
+		EvaluateBatch(Fields[ZoneIndex], int32_t(ZonePriority[ZoneIndex]), X.data() + Start, Y.data() + Start, Z.data() + Start, LanePriority.data() + Start,
+			OutX.data() + Start, OutY.data() + Start, OutZ.data() + Start, ZoneStart[ZoneIndex + 1] - Start);
+	}
+	for (int32_t Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		FVec3& Sum = Batched[LaneEntity[Lane]];
+		Sum = { Sum.X + OutX[Lane], Sum.Y + OutY[Lane], Sum.Z + OutZ[Lane] };
+	}
+
+	for (int32_t Entity = 0; Entity < NumEntities; ++Entity)
+	{
+		double Highest = LowestPriority;
+		for (int32_t ZoneIndex : EntityZones[Entity])
+		{
+			Highest = ZonePriority[ZoneIndex] > Highest ? ZonePriority[ZoneIndex] : Highest;
+		}
+		FVec3 Expected;
+		for (int32_t ZoneIndex : EntityZones[Entity])
+		{
+			if (ZonePriority[ZoneIndex] != Highest) continue;
+			const FVec3 Gravity = Evaluate(Fields[ZoneIndex], Positions[Entity]);
+			Expected = { Expected.X + Gravity.X, Expected.Y + Gravity.Y, Expected.Z + Gravity.Z };
+		}
+		CheckVec(Batched[Entity], Expected, 1.e-9);
+	}
+}
+
+// --- Direction Encoding ---
+static void CheckRoundTrip(const FVec3& Direction)
+{
+	//Two 16 bit coordinates resolve the sphere to well under a hundredth of a degree
+	const FVec3 Decoded = UnpackOctahedral(PackOctahedral(Direction));
+	const double Dot = Decoded.X * Direction.X + Decoded.Y * Direction.Y + Decoded.Z * Direction.Z;
+	if (!(Dot >= 1.0 - 1.e-8))
+	{
+		std::printf("%s:%d: (%.6f, %.6f, %.6f) decoded as (%.6f, %.6f, %.6f)\n", __FILE__, __LINE__,
+			Direction.X, Direction.Y, Direction.Z, Decoded.X, Decoded.Y, Decoded.Z);
+		++GFailures;
+	}
+}
+
+static void TestOctahedralRoundTrip()
+{
+	//Axes, including straight down where both folded coordinates are zero
+	for (const FVec3& Axis : { FVec3{ 1.0, 0.0, 0.0 }, FVec3{ -1.0, 0.0, 0.0 }, FVec3{ 0.0, 1.0, 0.0 }, FVec3{ 0.0, -1.0, 0.0 }, FVec3{ 0.0, 0.0, 1.0 }, FVec3{ 0.0, 0.0, -1.0 } })
+	{
+		CheckRoundTrip(Axis);
+	}
+	CheckVec(UnpackOctahedral(PackOctahedral({ 0.0, 0.0, -1.0 })), { 0.0, 0.0, -1.0 }, 1.e-12);
+
+	//45 degree diagonals between every pair of axes, half of them with a zero component in the lower hemisphere
+	const double Diagonal = std::sqrt(0.5);
+	for (int32_t First = 0; First < 3; ++First)
+	{
+		for (int32_t Second = First + 1; Second < 3; ++Second)
+		{
+			for (double FirstSign : { 1.0, -1.0 })
+			{
+				for (double SecondSign : { 1.0, -1.0 })
+				{
+					double Components[3] = { 0.0, 0.0, 0.0 };
+					Components[First] = FirstSign * Diagonal;
+					Components[Second] = SecondSign * Diagonal;
+					CheckRoundTrip({ Components[0], Components[1], Components[2] });
+				}
+			}
+		}
+	}
+
+	std::mt19937_64 Random(99);
+	std::normal_distribution<double> Normal;
+	for (int32_t Index = 0; Index < 10000; ++Index)
+	{
+		const FVec3 Sample = { Normal(Random), Normal(Random), Normal(Random) };
+		const double Length = std::sqrt(Sample.X * Sample.X + Sample.Y * Sample.Y + Sample.Z * Sample.Z);
+		if (Length < 1.e-6) continue;
+		CheckRoundTrip({ Sample.X / Length, Sample.Y / Length, Sample.Z / Length });
+	}
+}
+
+int main()
+{
+	TestUniform();
+	TestRadial();
+	TestCylindrical();
+	TestPlanar();
+	TestBatchMatchesScalar();
+	TestBatchPriorityMask();
+	TestResolvePriorities();
+	TestResolvedBatchSum();
+	TestOctahedralRoundTrip();
+
+	std::printf("GravityKernelTests (%s, %d lanes): %s, %d failures\n", GetVectorPathName(), GetVectorPathWidth(), GFailures ? "FAILED" : "passed", GFailures);
+	return GFailures ? 1 : 0;
+}